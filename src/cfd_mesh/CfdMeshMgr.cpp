@@ -12,6 +12,7 @@
 //#include "feaStructScreen.h"
 #include "Util.h"
 #include "SubSurfaceMgr.h"
+#include "ParallelUtil.h"
 #include "main.h"
 
 #ifdef DEBUG_CFD_MESH
@@ -365,6 +366,9 @@ CfdMeshMgrSingleton::CfdMeshMgrSingleton() : ParmContainer()
 
     m_MeshInProgress = false;
 
+    m_RemeshCacheFlag = true;
+    m_NumRemeshReused = 0;
+
 #ifdef DEBUG_CFD_MESH
     m_DebugDir  = Stringc( "MeshDebug/" );
     _mkdir( m_DebugDir.get_char_star() );
@@ -554,6 +558,7 @@ void CfdMeshMgrSingleton::CleanUp()
 
 void CfdMeshMgrSingleton::addOutputText( const string &str, int output_type )
 {
+    lock_guard< mutex > lock( m_OutStreamMutex );
     m_OutStream << str;
 }
 
@@ -1187,11 +1192,21 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
     MSCloud ms_cloud;
     vector< MapSource* > allsources;
 
+    GetGridDensityPtr()->BuildSourceTree();
+
+    //==== Each Surface Owns Its Map - Build Them Concurrently, Gather In Surface Order ====//
+    int nsurf = ( int )m_SurfVec.size();
+    vector< vector< MapSource* > > surf_sources( nsurf );
+    ParallelFor( nsurf, [&]( int isurf )
+    {
+        m_SurfVec[isurf]->BuildTargetMap( surf_sources[isurf], isurf );
+        m_SurfVec[isurf]->LimitTargetMap();
+    } );
+
     int i;
-    for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    for ( i = 0 ; i < nsurf ; i++ )
     {
-        m_SurfVec[i]->BuildTargetMap( allsources, i );
-        m_SurfVec[i]->LimitTargetMap();
+        allsources.insert( allsources.end(), surf_sources[i].begin(), surf_sources[i].end() );
     }
 
     // Set up split sources to provide a source at the endpoint of curves where
@@ -1279,52 +1294,152 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
     splitSources.clear();
 }
 
+//==== Collects Per Surface Remesh Text And Writes It In Surface Order ====//
+// Surfaces are remeshed concurrently, so each one buffers its progress lines and
+// the buffers are flushed as soon as every lower numbered surface has finished.
+// The output stream therefore matches a serial run line for line.
+class SurfOutputQueue
+{
+public:
+    SurfOutputQueue( CfdMeshMgrSingleton* mgr, int nsurf, int output_type ) :
+        m_Mgr( mgr ), m_Text( nsurf ), m_Done( nsurf, 0 ), m_Next( 0 ), m_OutputType( output_type )
+    {
+    }
+
+    void Finish( int isurf, const string & text )
+    {
+        lock_guard< mutex > lock( m_Mutex );
+        m_Text[isurf] = text;
+        m_Done[isurf] = 1;
+
+        while ( m_Next < ( int )m_Done.size() && m_Done[m_Next] )
+        {
+            if ( !m_Text[m_Next].empty() )
+            {
+                m_Mgr->addOutputText( m_Text[m_Next], m_OutputType );
+            }
+            m_Text[m_Next].clear();
+            m_Next++;
+        }
+    }
+
+private:
+    CfdMeshMgrSingleton* m_Mgr;
+    mutex m_Mutex;
+    vector< string > m_Text;
+    vector< int > m_Done;
+    int m_Next;
+    int m_OutputType;
+};
+
 void CfdMeshMgrSingleton::Remesh( int output_type )
 {
     char str[256];
-    int total_num_tris = 0;
     int nsurf = ( int )m_SurfVec.size();
-    for ( int i = 0 ; i < nsurf ; ++i )
+    vector< int > num_tris( nsurf, 0 );
+    vector< uint64_t > fingerprints( nsurf, 0 );
+    vector< int > reused( nsurf, 0 );
+    SurfOutputQueue out_queue( this, nsurf, output_type );
+
+    //==== Each Surface Owns Its Mesh - Remesh Them Concurrently ====//
+    ParallelFor( nsurf, [&]( int i )
     {
-        int num_tris = 0;
+        char surf_str[256];
+        string text;
+
+        //==== Same Mesh, Geometry, Target Map And Density As Last Time - Reuse Result ====//
+        if ( m_RemeshCacheFlag )
+        {
+            fingerprints[i] = m_SurfVec[i]->ComputeRemeshFingerprint();
+
+            map< uint64_t, RemeshCacheEntry >::const_iterator c = m_RemeshCache.find( fingerprints[i] );
+            if ( c != m_RemeshCache.end() )
+            {
+                m_SurfVec[i]->GetMesh()->Clear();
+                m_SurfVec[i]->GetMesh()->GetSimpPntVec() = c->second.m_PntVec;
+                m_SurfVec[i]->GetMesh()->GetSimpUWPntVec() = c->second.m_UWPntVec;
+                m_SurfVec[i]->GetMesh()->GetSimpTriVec() = c->second.m_TriVec;
+
+                reused[i] = 1;
+                num_tris[i] = ( int )c->second.m_TriVec.size();
+
+                sprintf( surf_str, "Surf %d/%d Reused Num Tris = %d\n", i + 1, nsurf, num_tris[i] );
+                if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT )
+                {
+                    text += surf_str;
+                }
+                out_queue.Finish( i, text );
+                return;
+            }
+        }
 
         int num_rev_removed = 0;
 
         for ( int iter = 0 ; iter < 10 ; ++iter )
         {
-            num_tris = 0;
             m_SurfVec[i]->GetMesh()->Remesh();
 
             num_rev_removed = m_SurfVec[i]->GetMesh()->RemoveRevTris();
 
+            num_tris[i] = m_SurfVec[i]->GetMesh()->GetTriList().size();
 
-            num_tris += m_SurfVec[i]->GetMesh()->GetTriList().size();
-
-            sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
+            sprintf( surf_str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris[i] );
             if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT )
             {
-                addOutputText( str, output_type );
+                text += surf_str;
             }
         }
-        total_num_tris += num_tris;
 
         if ( num_rev_removed > 0 )
         {
-            sprintf( str, "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
+            sprintf( surf_str, "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
             if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT )
             {
-                addOutputText( str, output_type );
+                text += surf_str;
             }
         }
 
         m_SurfVec[i]->GetMesh()->LoadSimpTris();
         m_SurfVec[i]->GetMesh()->Clear();
+
+        out_queue.Finish( i, text );
+    } );
+
+    //==== Keep Only This Mesh's Surfaces, Stored Before Tagging ====//
+    m_NumRemeshReused = 0;
+    map< uint64_t, RemeshCacheEntry > cache;
+    if ( m_RemeshCacheFlag )
+    {
+        for ( int i = 0 ; i < nsurf ; ++i )
+        {
+            m_NumRemeshReused += reused[i];
+
+            RemeshCacheEntry & entry = cache[ fingerprints[i] ];
+            entry.m_PntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
+            entry.m_UWPntVec = m_SurfVec[i]->GetMesh()->GetSimpUWPntVec();
+            entry.m_TriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
+        }
+    }
+    m_RemeshCache.swap( cache );
+
+    //==== Subtagging Fills The Shared Tag Combos - Keep It Serial And Ordered ====//
+    int total_num_tris = 0;
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        total_num_tris += num_tris[i];
+
         m_SurfVec[i]->Subtag( GetCfdSettingsPtr()->GetIntersectSubSurfs() );
         m_SurfVec[i]->GetMesh()->CondenseSimpTris();
     }
 
     m_WakeMgr.StretchWakes();
 
+    if ( m_NumRemeshReused > 0 )
+    {
+        sprintf( str, "Reused %d/%d Unchanged Surfaces\n", m_NumRemeshReused, nsurf );
+        addOutputText( str, output_type );
+    }
+
     sprintf( str, "Total Num Tris = %d\n", total_num_tris );
     addOutputText( str, output_type );
 }
@@ -1332,28 +1447,39 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
 void CfdMeshMgrSingleton::RemeshSingleComp( int comp_id, int output_type )
 {
     char str[256];
-    int total_num_tris = 0;
     int nsurf = ( int )m_SurfVec.size();
-    for ( int i = 0 ; i < nsurf ; i++ )
+    vector< int > num_tris( nsurf, 0 );
+    SurfOutputQueue out_queue( this, nsurf, output_type );
+
+    ParallelFor( nsurf, [&]( int i )
     {
-        int num_tris = 0;
+        char surf_str[256];
+        string text;
+
         if ( m_SurfVec[i]->GetCompID() == comp_id )
         {
             for ( int iter = 0 ; iter < 10 ; iter++ )
             {
-                num_tris = 0;
                 m_SurfVec[i]->GetMesh()->Remesh();
 
-                num_tris += m_SurfVec[i]->GetMesh()->GetTriList().size();
+                num_tris[i] = m_SurfVec[i]->GetMesh()->GetTriList().size();
 
-                sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
-                addOutputText( str, output_type );
+                sprintf( surf_str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris[i] );
+                text += surf_str;
             }
-            total_num_tris += num_tris;
         }
 
         m_SurfVec[i]->GetMesh()->LoadSimpTris();
         m_SurfVec[i]->GetMesh()->Clear();
+
+        out_queue.Finish( i, text );
+    } );
+
+    int total_num_tris = 0;
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        total_num_tris += num_tris[i];
+
         m_SurfVec[i]->Subtag( GetCfdSettingsPtr()->GetIntersectSubSurfs() );
         m_SurfVec[i]->GetMesh()->CondenseSimpTris();
     }
@@ -2570,11 +2696,7 @@ void CfdMeshMgrSingleton::Intersect()
     if ( GetCfdSettingsPtr()->GetIntersectSubSurfs() ) BuildSubSurfIntChains();
 
     //==== Quad Tree Intersection - Intersection Segments Get Loaded at AddIntersectionSeg ===//
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-        for ( int j = i + 1 ; j < ( int )m_SurfVec.size() ; j++ )
-        {
-            m_SurfVec[i]->Intersect( m_SurfVec[j] );
-        }
+    IntersectSurfPatches();
 
 
     BuildChains();
@@ -2860,43 +2982,55 @@ void CfdMeshMgrSingleton::InitMesh( )
     ConnectBorderEdges( true );         // Only Wakes
 }
 
-void CfdMeshMgrSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3d & ip0, vec3d & ip1 )
+//==== Intersect All Surface Pairs - Patch Pairs Are Subdivided Concurrently ====//
+void CfdMeshMgrSingleton::IntersectSurfPatches()
 {
-    double d = dist_squared( ip0, ip1 );
-    if ( d < DBL_EPSILON )
+    vector< pair< SurfPatch*, SurfPatch* > > patch_pairs;
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+        for ( int j = i + 1 ; j < ( int )m_SurfVec.size() ; j++ )
+        {
+            m_SurfVec[i]->FindIntersectPatchPairs( m_SurfVec[j], patch_pairs );
+        }
+
+    vector< vector< PatchISeg > > pair_isegs( patch_pairs.size() );
+    ParallelFor( ( int )patch_pairs.size(), [&]( int p )
     {
-        return;
+        intersect( *patch_pairs[p].first, *patch_pairs[p].second, 0, pair_isegs[p] );
+    } );
+
+    //==== Segments Have Always Been Loaded Into The CFD Mesh Singleton, Keep Pair Order ====//
+    for ( int p = 0 ; p < ( int )pair_isegs.size() ; p++ )
+    {
+        for ( int s = 0 ; s < ( int )pair_isegs[p].size() ; s++ )
+        {
+            CfdMeshMgr.AddIntersectionSeg( pair_isegs[p][s] );
+        }
     }
+}
 
-    vec2d proj_uwA0;
-    pA.find_closest_uw( ip0, proj_uwA0.v );
-    Puw* puwA0 = new Puw( pA.get_surf_ptr(), proj_uwA0 );
+void CfdMeshMgrSingleton::AddIntersectionSeg( const PatchISeg & seg )
+{
+    Puw* puwA0 = new Puw( seg.m_SurfA, seg.m_UWA[0] );
     m_DelPuwVec.push_back( puwA0 );
 
-    vec2d proj_uwB0;
-    pB.find_closest_uw( ip0, proj_uwB0.v );
-    Puw* puwB0 = new Puw( pB.get_surf_ptr(), proj_uwB0 );
+    Puw* puwB0 = new Puw( seg.m_SurfB, seg.m_UWB[0] );
     m_DelPuwVec.push_back( puwB0 );
 
     IPnt* ipnt0 = new IPnt( puwA0, puwB0 );
-    ipnt0->m_Pnt = ip0;
+    ipnt0->m_Pnt = seg.m_Pnt[0];
     m_DelIPntVec.push_back( ipnt0 );
 
-    vec2d proj_uwA1;
-    pA.find_closest_uw( ip1, proj_uwA1.v );
-    Puw* puwA1 = new Puw( pA.get_surf_ptr(), proj_uwA1 );
+    Puw* puwA1 = new Puw( seg.m_SurfA, seg.m_UWA[1] );
     m_DelPuwVec.push_back( puwA1 );
 
-    vec2d proj_uwB1;
-    pB.find_closest_uw( ip1, proj_uwB1.v );
-    Puw* puwB1 = new Puw( pB.get_surf_ptr(), proj_uwB1 );
+    Puw* puwB1 = new Puw( seg.m_SurfB, seg.m_UWB[1] );
     m_DelPuwVec.push_back( puwB1 );
 
     IPnt* ipnt1 = new IPnt( puwA1, puwB1 );
-    ipnt1->m_Pnt = ip1;
+    ipnt1->m_Pnt = seg.m_Pnt[1];
     m_DelIPntVec.push_back( ipnt1 );
 
-    new ISeg( pA.get_surf_ptr(), pB.get_surf_ptr(), ipnt0, ipnt1 );
+    new ISeg( seg.m_SurfA, seg.m_SurfB, ipnt0, ipnt1 );
 
     int id0 = IPntBin::ComputeID( ipnt0->m_Pnt );
     m_BinMap[id0].m_ID = id0;
@@ -2917,11 +3051,11 @@ void CfdMeshMgrSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3
         onetime = false;
     }
 
-    double dA0 = dist( ip0, puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
-    double dB0 = dist( ip0, puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
+    double dA0 = dist( seg.m_Pnt[0], puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
+    double dB0 = dist( seg.m_Pnt[0], puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
 
-    double dA1 = dist( ip1, puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
-    double dB1 = dist( ip1, puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
+    double dA1 = dist( seg.m_Pnt[1], puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
+    double dB1 = dist( seg.m_Pnt[1], puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
 
     double tol = 1.0e-8;
     double total_d = dA0 + dB0 + dA1 + dB1;
@@ -4092,7 +4226,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s ) // every surface
     {
         int tri_comp_id = m_SurfVec[s]->GetCompID();
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+        list <Tri*>& triList = m_SurfVec[s]->GetMesh()->GetTriList();
         for ( t = triList.begin() ; t != triList.end(); ++t ) // every triangle
         {
             vector< vector< double > > t_vec_vec;
@@ -4185,7 +4319,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     //==== Check Vote and Mark Interior Tris =====//
     for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s )
     {
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+        list <Tri*>& triList = m_SurfVec[s]->GetMesh()->GetTriList();
         for ( t = triList.begin() ; t != triList.end(); t++ )
         {
             for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
@@ -4213,7 +4347,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     for ( int a = 0 ; a < ( int )m_SurfVec.size() ; a++ )
     {
         int tri_comp_id = m_SurfVec[a]->GetCompID();
-        list< Tri * > triList = m_SurfVec[a]->GetMesh()->GetTriList();
+        list< Tri * >& triList = m_SurfVec[a]->GetMesh()->GetTriList();
         for ( t = triList.begin(); t != triList.end(); ++t )
         {
             // Determine if the triangle should be deleted
@@ -4228,7 +4362,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
         {
             if ( ! m_SurfVec[s]->GetSymPlaneFlag() )
             {
-                list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+                list <Tri*>& triList = m_SurfVec[s]->GetMesh()->GetTriList();
                 for ( t = triList.begin() ; t != triList.end(); t++ )
                 {
                     vec3d cp = ( *t )->ComputeCenterPnt( m_SurfVec[s] );
@@ -4243,7 +4377,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
             {
                 if ( m_SurfVec[s]->GetSymPlaneFlag() )
                 {
-                    list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+                    list <Tri*>& triList = m_SurfVec[s]->GetMesh()->GetTriList();
                     for ( t = triList.begin() ; t != triList.end(); t++ )
                     {
                         ( *t )->deleteFlag = true;
@@ -4269,7 +4403,7 @@ void CfdMeshMgrSingleton::ConnectBorderEdges( bool wakeOnly )
     {
         if ( m_SurfVec[s]->GetWakeFlag() == wakeOnly )
         {
-            list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+            list <Tri*>& triList = m_SurfVec[s]->GetMesh()->GetTriList();
             for ( t = triList.begin() ; t != triList.end(); t++ )
             {
                 if ( ( *t )->e0->OtherTri( ( *t ) ) == NULL )
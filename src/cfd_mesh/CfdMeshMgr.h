@@ -21,8 +21,9 @@
 //              Match SCurves to create ICurves.  Create wakes surfs.
 //
 //  Intersect: Intersect all surfaces.  Intersect Y Slice Plane.
-//      Surf::Intersect - subdivide in to patchs, keep splitting till planer, intersect.
-//          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments.
+//      CfdMeshMgr::IntersectSurfPatches - find overlapping patch pairs through each surf's patch box tree,
+//          subdivide pairs concurrently till planer, intersect into per pair buffers.
+//          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments, in pair order.
 //
 //      CfdMeshMgr::LoadBorderCurves: Tesselate border curves, build border chains.
 //
@@ -46,6 +47,7 @@
 //              Remove intierior triangles.
 //
 //      CfdMeshMgr::Remesh: Remesh (split, collapse, swap, smooth) each surface mesh triangle.
+//              Surfaces whose remesh input is unchanged since the last mesh reuse the cached result.
 //
 
 
@@ -57,6 +59,7 @@
 //#endif
 
 #include "Surf.h"
+#include "IntersectPatch.h"
 #include "Mesh.h"
 #include "SCurve.h"
 #include "ICurve.h"
@@ -80,10 +83,20 @@
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <mutex>
 using namespace std;
 
 class WakeMgr;
 
+//==== Remeshed Surface Tris Kept For Reuse By The Next Mesh ====//
+class RemeshCacheEntry
+{
+public:
+    vector< vec3d > m_PntVec;
+    vector< vec2d > m_UWPntVec;
+    vector< SimpTri > m_TriVec;
+};
+
 class Wake
 {
 public:
@@ -266,14 +279,33 @@ public:
     virtual void Remesh( int output_type );
     virtual void RemeshSingleComp( int comp_id, int output_type );
 
+    //==== Reuse Remeshed Surfaces Whose Inputs Did Not Change ====//
+    void SetRemeshCacheFlag( bool flag )
+    {
+        m_RemeshCacheFlag = flag;
+    }
+    bool GetRemeshCacheFlag()
+    {
+        return m_RemeshCacheFlag;
+    }
+    virtual void ClearRemeshCache()
+    {
+        m_RemeshCache.clear();
+    }
+    int GetNumRemeshReused()
+    {
+        return m_NumRemeshReused;
+    }
+
     virtual void Intersect();
+    virtual void IntersectSurfPatches();
     virtual void InitMesh();
 
     virtual void PrintQual();
     virtual string GetQualString();
 
 //  virtual void AddISeg( Surf* sA, Surf* sB, vec2d & sAuw0, vec2d & sAuw1,  vec2d & sBuw0, vec2d & sBuw1 );
-    virtual void AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3d & ip0, vec3d & ip1 );
+    virtual void AddIntersectionSeg( const PatchISeg & seg );
 //  virtual ISeg* CreateSurfaceSeg( Surf* sPtr, vec3d & p0, vec3d & p1, vec2d & uw0, vec2d & uw1 );
     virtual ISeg* CreateSurfaceSeg( Surf* surfA, vec2d & uwA0, vec2d & uwA1, Surf* surfB, vec2d & uwB0, vec2d & uwB1  );
 
@@ -348,6 +380,7 @@ public:
 #endif
 
     stringstream m_OutStream;
+    mutex m_OutStreamMutex;   // Guards m_OutStream, written by meshing threads and read by the GUI
 
 
     CfdMeshSettings* GetCfdSettingsPtr()
@@ -382,6 +415,12 @@ protected:
 
     vector< Surf* > m_SurfVec;
 
+    // Keyed by Surf::ComputeRemeshFingerprint.  Survives CleanUp so the next
+    // GenerateMesh can skip remeshing surfaces nothing has touched.
+    bool m_RemeshCacheFlag;
+    map< uint64_t, RemeshCacheEntry > m_RemeshCache;
+    int m_NumRemeshReused;
+
     //==== Wakes ====//
     WakeMgr m_WakeMgr;
 
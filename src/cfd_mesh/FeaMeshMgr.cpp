@@ -818,11 +818,7 @@ void FeaMeshMgrSingleton::Export()
 
 void FeaMeshMgrSingleton::Intersect()
 {
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-        for ( int j = i + 1 ; j < ( int )m_SurfVec.size() ; j++ )
-        {
-            m_SurfVec[i]->Intersect( m_SurfVec[j] );
-        }
+    IntersectSurfPatches();
 
     BuildChains();
 //DebugWriteChains("Intersect_UW", false );
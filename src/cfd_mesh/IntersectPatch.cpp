@@ -13,7 +13,7 @@
 // #include "FeaMeshMgr.h"
 #include "Tritri.h"
 
-void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
+void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth, vector< PatchISeg > & isegs )
 {
     int MAX_SUB = 3;
     if ( !Compare( *bp1.get_bbox(), *bp2.get_bbox() ) )
@@ -32,7 +32,7 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
 
     if ( bp1.GetSubDepth() > MAX_SUB && bp2.GetSubDepth() > MAX_SUB )
     {
-        intersect_quads( bp1, bp2 );          // Plane - Plane Intersection
+        intersect_quads( bp1, bp2, isegs );   // Plane - Plane Intersection
     }
     else
     {
@@ -44,10 +44,10 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
                 bps1[i].SetSubDepth( bp1.GetSubDepth() + 1 );
             }
 
-            intersect( bps1[0], bp2, depth );
-            intersect( bps1[1], bp2, depth );
-            intersect( bps1[2], bp2, depth );
-            intersect( bps1[3], bp2, depth );
+            intersect( bps1[0], bp2, depth, isegs );
+            intersect( bps1[1], bp2, depth, isegs );
+            intersect( bps1[2], bp2, depth, isegs );
+            intersect( bps1[3], bp2, depth, isegs );
         }
         else
         {
@@ -57,15 +57,15 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
                 bps2[i].SetSubDepth( bp2.GetSubDepth() + 1 );
             }
 
-            intersect( bp1, bps2[0], depth );
-            intersect( bp1, bps2[1], depth );
-            intersect( bp1, bps2[2], depth );
-            intersect( bp1, bps2[3], depth );
+            intersect( bp1, bps2[0], depth, isegs );
+            intersect( bp1, bps2[1], depth, isegs );
+            intersect( bp1, bps2[2], depth, isegs );
+            intersect( bp1, bps2[3], depth, isegs );
         }
     }
 }
 
-void intersect_quads( SurfPatch& pa, SurfPatch& pb )
+void intersect_quads( SurfPatch& pa, SurfPatch& pb, vector< PatchISeg > & isegs )
 {
     int iflag;
     int coplanar;
@@ -84,28 +84,50 @@ void intersect_quads( SurfPatch& pa, SurfPatch& pb )
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_patch_iseg( pa, pb, ip0, ip1, isegs );
     }
 
     //==== Tri A1 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_patch_iseg( pa, pb, ip0, ip1, isegs );
     }
 
     //==== Tri A2 and B1 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb,  ip0, ip1 );
+        add_patch_iseg( pa, pb, ip0, ip1, isegs );
     }
 
     //==== Tri A2 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_patch_iseg( pa, pb, ip0, ip1, isegs );
     }
 }
 
+//===== Project A Segment To Both Patches While They Are Still In Scope =====//
+void add_patch_iseg( SurfPatch& pa, SurfPatch& pb, vec3d & ip0, vec3d & ip1, vector< PatchISeg > & isegs )
+{
+    double d = dist_squared( ip0, ip1 );
+    if ( d < DBL_EPSILON )
+    {
+        return;
+    }
+
+    PatchISeg seg;
+    seg.m_SurfA = pa.get_surf_ptr();
+    seg.m_SurfB = pb.get_surf_ptr();
+    seg.m_Pnt[0] = ip0;
+    seg.m_Pnt[1] = ip1;
+
+    pa.find_closest_uw( ip0, seg.m_UWA[0].v );
+    pb.find_closest_uw( ip0, seg.m_UWB[0].v );
+    pa.find_closest_uw( ip1, seg.m_UWA[1].v );
+    pb.find_closest_uw( ip1, seg.m_UWB[1].v );
+
+    isegs.push_back( seg );
+}
@@ -25,8 +25,21 @@
 using namespace std;
 
 
-//===== Intersect Two Bezier Patches  =====//
-void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth );
-void intersect_quads( SurfPatch& pa, SurfPatch& pb );
+//===== Intersection Segment Between Two Patches, Projected To Both Surfaces =====//
+class PatchISeg
+{
+public:
+    Surf* m_SurfA;
+    Surf* m_SurfB;
+
+    vec3d m_Pnt[2];
+    vec2d m_UWA[2];
+    vec2d m_UWB[2];
+};
+
+//===== Intersect Two Bezier Patches - Segments Are Appended To isegs  =====//
+void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth, vector< PatchISeg > & isegs );
+void intersect_quads( SurfPatch& pa, SurfPatch& pb, vector< PatchISeg > & isegs );
+void add_patch_iseg( SurfPatch& pa, SurfPatch& pb, vec3d & ip0, vec3d & ip1, vector< PatchISeg > & isegs );
 
 #endif
@@ -30,8 +30,15 @@ bool ShortEdgeTargetLengthCompare( const Edge* a, const Edge* b )
 
 
 
-Mesh::Mesh()
+bool Mesh::m_PoolFlag = true;
+
+// FindNode matches within sqrt( 1.0e-7 ), so a larger cell only needs the
+// 3x3x3 neighborhood of the query cell searched.
+static const double NODE_HASH_CELL = 1.0e-3;
+
+Mesh::Mesh() : m_NodePool( m_PoolFlag ), m_EdgePool( m_PoolFlag ), m_TriPool( m_PoolFlag )
 {
+    m_NodeHashValid = false;
     m_HighlightNodeIndex = 0;
     m_HighlightEdgeIndex = 2;
 
@@ -47,10 +54,12 @@ Mesh::~Mesh()
 
 void Mesh::Clear()
 {
+    DumpGarbage();
+
     list< Tri* >::iterator t;
     for ( t = triList.begin() ; t != triList.end(); t++ )
     {
-        delete ( *t );
+        m_TriPool.Release( *t );
     }
 
     triList.clear();
@@ -58,7 +67,7 @@ void Mesh::Clear()
     list< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
-        delete ( *e );
+        m_EdgePool.Release( *e );
     }
 
     edgeList.clear();
@@ -66,11 +75,18 @@ void Mesh::Clear()
     list< Node* >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
     {
-        delete ( *n );
+        m_NodePool.Release( *n );
     }
 
     nodeList.clear();
 
+    //==== Everything Released - Hand The Blocks Back ====//
+    m_TriPool.FreeChunks();
+    m_EdgePool.FreeChunks();
+    m_NodePool.FreeChunks();
+
+    m_NodeHash.clear();
+    m_NodeHashValid = false;
 
 }
 
@@ -224,6 +240,52 @@ void Mesh::Remesh()
 
 }
 
+void Mesh::AddFingerprint( MeshFingerprint & fp )
+{
+    if ( m_GridDensity )
+    {
+        fp.Add( m_GridDensity->m_MinLen() );
+        fp.Add( m_GridDensity->m_GrowRatio() );
+    }
+
+    //==== List Order Matters To Remesh, So Hash It Too ====//
+    unordered_map< Node*, int > node_ind;
+    fp.Add( ( int )nodeList.size() );
+    for ( list< Node* >::iterator n = nodeList.begin() ; n != nodeList.end(); n++ )
+    {
+        int ind = ( int )node_ind.size();
+        node_ind[ *n ] = ind;
+
+        fp.Add( ( *n )->pnt );
+        fp.Add( ( *n )->uw );
+        fp.Add( ( *n )->fixed );
+    }
+
+    unordered_map< Edge*, int > edge_ind;
+    fp.Add( ( int )edgeList.size() );
+    for ( list< Edge* >::iterator e = edgeList.begin() ; e != edgeList.end(); e++ )
+    {
+        int ind = ( int )edge_ind.size();
+        edge_ind[ *e ] = ind;
+
+        fp.Add( node_ind[ ( *e )->n0 ] );
+        fp.Add( node_ind[ ( *e )->n1 ] );
+        fp.Add( ( *e )->border );
+        fp.Add( ( *e )->ridge );
+    }
+
+    fp.Add( ( int )triList.size() );
+    for ( list< Tri* >::iterator t = triList.begin() ; t != triList.end(); t++ )
+    {
+        fp.Add( node_ind[ ( *t )->n0 ] );
+        fp.Add( node_ind[ ( *t )->n1 ] );
+        fp.Add( node_ind[ ( *t )->n2 ] );
+        fp.Add( edge_ind[ ( *t )->e0 ] );
+        fp.Add( edge_ind[ ( *t )->e1 ] );
+        fp.Add( edge_ind[ ( *t )->e2 ] );
+    }
+}
+
 void Mesh::LoadSimpTris()
 {
     list< Tri* >::iterator t;
@@ -512,9 +574,14 @@ void Mesh::ColorTris()
 
 Node* Mesh::AddNode( vec3d p, vec2d uw_in )
 {
-    Node* nptr = new Node( p, uw_in );
+    Node* nptr = m_NodePool.Alloc( p, uw_in );
     nodeList.push_back( nptr );
     nptr->list_ptr = --nodeList.end();
+
+    if ( m_NodeHashValid )
+    {
+        AddNodeToHash( nptr );
+    }
     return nptr;
 }
 
@@ -524,24 +591,71 @@ void Mesh::RemoveNode( Node* nptr )
     nodeList.erase( nptr->list_ptr );
 
     nptr->m_DeleteMeFlag = true;
+    m_NodeHashValid = false;
 }
 
-Node* Mesh::FindNode( const vec3d& p )
+size_t Mesh::NodeHashKey( int i, int j, int k )
+{
+    return ( size_t )i * 73856093u ^ ( size_t )j * 19349663u ^ ( size_t )k * 83492791u;
+}
+
+void Mesh::AddNodeToHash( Node* nptr )
+{
+    int i = ( int )floor( nptr->pnt.x() / NODE_HASH_CELL );
+    int j = ( int )floor( nptr->pnt.y() / NODE_HASH_CELL );
+    int k = ( int )floor( nptr->pnt.z() / NODE_HASH_CELL );
+    m_NodeHash[ NodeHashKey( i, j, k ) ].push_back( nptr );
+}
+
+void Mesh::BuildNodeHash()
 {
+    m_NodeHash.clear();
+    m_NodeHash.reserve( nodeList.size() );
+
     list< Node* >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
     {
-        if ( !( *n )->m_DeleteMeFlag && dist_squared( ( *n )->pnt, p ) < 1.0e-7 )
-        {
-            return ( *n );
-        }
+        AddNodeToHash( *n );
     }
+    m_NodeHashValid = true;
+}
+
+Node* Mesh::FindNode( const vec3d& p )
+{
+    if ( !m_NodeHashValid )
+    {
+        BuildNodeHash();
+    }
+
+    int ic = ( int )floor( p.x() / NODE_HASH_CELL );
+    int jc = ( int )floor( p.y() / NODE_HASH_CELL );
+    int kc = ( int )floor( p.z() / NODE_HASH_CELL );
+
+    for ( int i = ic - 1 ; i <= ic + 1 ; i++ )
+        for ( int j = jc - 1 ; j <= jc + 1 ; j++ )
+            for ( int k = kc - 1 ; k <= kc + 1 ; k++ )
+            {
+                unordered_map< size_t, vector< Node* > >::iterator cell = m_NodeHash.find( NodeHashKey( i, j, k ) );
+                if ( cell == m_NodeHash.end() )
+                {
+                    continue;
+                }
+
+                vector< Node* >& cell_nodes = cell->second;
+                for ( int n = 0 ; n < ( int )cell_nodes.size() ; n++ )
+                {
+                    if ( !cell_nodes[n]->m_DeleteMeFlag && dist_squared( cell_nodes[n]->pnt, p ) < 1.0e-7 )
+                    {
+                        return cell_nodes[n];
+                    }
+                }
+            }
     return NULL;
 }
 
 Edge* Mesh::AddEdge( Node* n0, Node* n1 )
 {
-    Edge* eptr = new Edge( n0, n1 );
+    Edge* eptr = m_EdgePool.Alloc( n0, n1 );
 
     edgeList.push_back( eptr );
     eptr->list_ptr = --edgeList.end();
@@ -567,19 +681,13 @@ void Mesh::RemoveEdge( Edge* eptr )
 
 Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 {
-    list< Edge* >::iterator e;
-    for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
+    //==== Only Edges Connected To n0 Can Match ====//
+    for ( int i = 0 ; i < ( int )n0->edgeVec.size() ; i++ )
     {
-        if ( !( *e )->m_DeleteMeFlag )
+        Edge* eptr = n0->edgeVec[i];
+        if ( !eptr->m_DeleteMeFlag && eptr->ContainsNodes( n0, n1 ) )
         {
-            if ( ( *e )->n0 == n0 && ( *e )->n1 == n1 )
-            {
-                return ( *e );
-            }
-            if ( ( *e )->n0 == n1 && ( *e )->n1 == n0 )
-            {
-                return ( *e );
-            }
+            return eptr;
         }
     }
     return NULL;
@@ -587,7 +695,7 @@ Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 
 Tri* Mesh::AddTri( Node* n0, Node* n1, Node* n2, Edge* e0, Edge* e1, Edge* e2 )
 {
-    Tri* tptr = new Tri( n0, n1, n2, e0, e1, e2 );
+    Tri* tptr = m_TriPool.Alloc( n0, n1, n2, e0, e1, e2 );
     triList.push_back( tptr );
     tptr->list_ptr = --triList.end();
     return tptr;
@@ -605,21 +713,21 @@ void Mesh::DumpGarbage()
     //==== Delete Flagged Nodes =====//
     for ( int i = 0 ; i < ( int )garbageNodeVec.size() ; i++ )
     {
-        delete garbageNodeVec[i];
+        m_NodePool.Release( garbageNodeVec[i] );
     }
     garbageNodeVec.clear();
 
     //==== Delete Flagged Edges =====//
     for ( int i = 0 ; i < ( int )garbageEdgeVec.size() ; i++ )
     {
-        delete garbageEdgeVec[i];
+        m_EdgePool.Release( garbageEdgeVec[i] );
     }
     garbageEdgeVec.clear();
 
     //==== Delete Flagged Tris =====//
     for ( int i = 0 ; i < ( int )garbageTriVec.size() ; i++ )
     {
-        delete garbageTriVec[i];
+        m_TriPool.Release( garbageTriVec[i] );
     }
     garbageTriVec.clear();
 }
@@ -1261,6 +1369,8 @@ void Mesh::CollapseEdge( Edge* edge )
 
 void Mesh::LaplacianSmooth( int num_iter )
 {
+    m_NodeHashValid = false;
+
     for ( int i = 0 ; i < num_iter ; i++ )
     {
         list< Node* >::iterator n;
@@ -1283,6 +1393,8 @@ void Mesh::LaplacianSmooth( int num_iter )
 
 void Mesh::OptSmooth( int num_iter )
 {
+    m_NodeHashValid = false;
+
     for ( int i = 0 ; i < num_iter ; i++ )
     {
         list< Node* >::iterator n;
@@ -1299,6 +1411,8 @@ void Mesh::OptSmooth( int num_iter )
 
 void Mesh::AdjustEdgeLengths()
 {
+    m_NodeHashValid = false;
+
     //==== Find Avg Edge Length ====//
     double avg_length = 0.0;
     list< Edge* >::iterator e;
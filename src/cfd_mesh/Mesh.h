@@ -14,6 +14,8 @@
 #include "Vec2d.h"
 #include "Vec3d.h"
 #include "Tri.h"
+#include "MeshPool.h"
+#include "MeshFingerprint.h"
 
 class Surf;
 class GridDensity;
@@ -28,6 +30,7 @@ class GridDensity;
 
 #include <vector>
 #include <list>
+#include <unordered_map>
 using namespace std;
 
 extern "C"
@@ -56,6 +59,9 @@ public:
 
     void Remesh();
     void LoadSimpTris();
+
+    //==== Hash Current Nodes, Edges, Tris And Density Limits ====//
+    void AddFingerprint( MeshFingerprint & fp );
     void CondenseSimpTris();
     int CheckDupOrAdd( int ind, map< int, vector< int > > & indMap, vector< vec3d > & pntVec );
 
@@ -138,7 +144,7 @@ public:
 
     void ColorTris();
 
-    list <Tri*> GetTriList()
+    list <Tri*>& GetTriList()
     {
         return triList;
     }
@@ -160,8 +166,24 @@ public:
 
     void RemoveInteriorTrisEdgesNodes();
 
+    //==== Pooled Node/Edge/Tri Storage - False Uses Plain new/delete ====//
+    static void SetPoolFlag( bool f )
+    {
+        m_PoolFlag = f;
+    }
+    static bool GetPoolFlag()
+    {
+        return m_PoolFlag;
+    }
+
 protected:
 
+    void BuildNodeHash();
+    void AddNodeToHash( Node* nptr );
+    size_t NodeHashKey( int i, int j, int k );
+
+    static bool m_PoolFlag;
+
     Surf* m_Surf;
     GridDensity* m_GridDensity;
 
@@ -173,6 +195,15 @@ protected:
     vector< Edge* > garbageEdgeVec;
     vector< Node* > garbageNodeVec;
 
+    MeshPool< Node > m_NodePool;
+    MeshPool< Edge > m_EdgePool;
+    MeshPool< Tri > m_TriPool;
+
+    // Spatial hash for FindNode, keyed by node position when built.  Anything
+    // that moves or removes nodes marks it invalid and FindNode rebuilds it.
+    unordered_map< size_t, vector< Node* > > m_NodeHash;
+    bool m_NodeHashValid;
+
     int m_HighlightNodeIndex;
     int m_HighlightEdgeIndex;
 
@@ -0,0 +1,85 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// MeshFingerprint.h
+//
+// Running 64 bit FNV-1a hash over the exact bits of the values fed to it.
+// Used to tell whether everything a surface remesh depends on is
+// unchanged since the last time it was meshed.
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(MESH_FINGERPRINT__INCLUDED_)
+#define MESH_FINGERPRINT__INCLUDED_
+
+#include "Vec2d.h"
+#include "Vec3d.h"
+
+#include <stdint.h>
+#include <string.h>
+
+class MeshFingerprint
+{
+public:
+
+    MeshFingerprint()
+    {
+        m_Hash = 14695981039346656037ULL;
+    }
+
+    void Add( const void* data, size_t num_bytes )
+    {
+        const unsigned char* bytes = static_cast< const unsigned char* >( data );
+        for ( size_t i = 0 ; i < num_bytes ; i++ )
+        {
+            m_Hash ^= bytes[i];
+            m_Hash *= 1099511628211ULL;
+        }
+    }
+
+    void Add( double val )
+    {
+        //==== Treat -0.0 And 0.0 As The Same Value ====//
+        if ( val == 0.0 )
+        {
+            val = 0.0;
+        }
+        Add( &val, sizeof( val ) );
+    }
+
+    void Add( int val )
+    {
+        Add( &val, sizeof( val ) );
+    }
+
+    void Add( bool val )
+    {
+        Add( val ? 1 : 0 );
+    }
+
+    void Add( const vec2d & v )
+    {
+        Add( v[0] );
+        Add( v[1] );
+    }
+
+    void Add( const vec3d & v )
+    {
+        Add( v[0] );
+        Add( v[1] );
+        Add( v[2] );
+    }
+
+    uint64_t Get() const
+    {
+        return m_Hash;
+    }
+
+protected:
+
+    uint64_t m_Hash;
+};
+
+#endif
@@ -0,0 +1,124 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// MeshPool.h
+//
+// Chunked object pool for the nodes, edges and tris of a Mesh.  Objects
+// are constructed in place inside large contiguous blocks and released
+// slots are recycled, so remeshing a surface does not make one heap call
+// per element and neighboring elements stay close in memory.
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(MESH_POOL__INCLUDED_)
+#define MESH_POOL__INCLUDED_
+
+#include <new>
+#include <utility>
+#include <vector>
+using namespace std;
+
+template < class T >
+class MeshPool
+{
+public:
+
+    MeshPool( bool pool_flag = true, int chunk_size = 4096 )
+    {
+        m_PoolFlag = pool_flag;
+        m_ChunkSize = chunk_size;
+        m_NumUsed = chunk_size;
+        m_NumLive = 0;
+    }
+
+    ~MeshPool()
+    {
+        FreeChunks();
+    }
+
+    //==== Construct Object, Reusing A Released Slot When Possible ====//
+    template < class ... Args >
+    T* Alloc( Args&& ... args )
+    {
+        m_NumLive++;
+
+        if ( !m_PoolFlag )
+        {
+            return new T( std::forward< Args >( args )... );
+        }
+
+        void* slot;
+        if ( !m_FreeVec.empty() )
+        {
+            slot = m_FreeVec.back();
+            m_FreeVec.pop_back();
+        }
+        else
+        {
+            if ( m_NumUsed == m_ChunkSize )
+            {
+                m_ChunkVec.push_back( static_cast< T* >( ::operator new( sizeof( T ) * m_ChunkSize ) ) );
+                m_NumUsed = 0;
+            }
+            slot = m_ChunkVec.back() + m_NumUsed;
+            m_NumUsed++;
+        }
+        return new( slot ) T( std::forward< Args >( args )... );
+    }
+
+    //==== Destroy Object And Keep Its Slot For Reuse ====//
+    void Release( T* ptr )
+    {
+        m_NumLive--;
+
+        if ( !m_PoolFlag )
+        {
+            delete ptr;
+            return;
+        }
+
+        ptr->~T();
+        m_FreeVec.push_back( ptr );
+    }
+
+    //==== Return All Blocks To The Heap - Every Object Must Be Released ====//
+    void FreeChunks()
+    {
+        for ( int i = 0 ; i < ( int )m_ChunkVec.size() ; i++ )
+        {
+            ::operator delete( m_ChunkVec[i] );
+        }
+        m_ChunkVec.clear();
+        m_FreeVec.clear();
+        m_NumUsed = m_ChunkSize;
+    }
+
+    int GetNumLive() const
+    {
+        return m_NumLive;
+    }
+
+    size_t GetNumBytes() const
+    {
+        return m_ChunkVec.size() * m_ChunkSize * sizeof( T );
+    }
+
+protected:
+
+    bool m_PoolFlag;            // False - plain new/delete, for comparison
+    int m_ChunkSize;
+    int m_NumUsed;              // Slots handed out of the last chunk
+    int m_NumLive;
+
+    vector< T* > m_ChunkVec;
+    vector< T* > m_FreeVec;
+
+private:
+
+    MeshPool( const MeshPool& );
+    MeshPool& operator=( const MeshPool& );
+};
+
+#endif
@@ -154,7 +154,9 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
         limitFlag = true;
     }
 
-    // Loop over surface evaluating source strength and curvature
+    // Evaluate map points, then source strength at all of them in one batch
+    int nmap = nmapu * nmapw;
+    vector< double > px( nmap ), py( nmap ), pz( nmap );
     for( int i = 0; i < nmapu ; i++ )
     {
         double u = umin + du * ( 1.0 * i ) / ( nmapu - 1 );
@@ -162,6 +164,25 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
         {
             double w = wmin + dw * ( 1.0 * j ) / ( nmapw - 1 );
 
+            vec3d p = m_SurfCore.CompPnt( u, w );
+            px[ i * nmapw + j ] = p.x();
+            py[ i * nmapw + j ] = p.y();
+            pz[ i * nmapw + j ] = p.z();
+        }
+    }
+
+    vector< double > grid_len_vec;
+    m_GridDensityPtr->GetTargetLen( px, py, pz, grid_len_vec, limitFlag );
+
+    // Loop over surface evaluating curvature and applying source strength
+    for( int i = 0; i < nmapu ; i++ )
+    {
+        double u = umin + du * ( 1.0 * i ) / ( nmapu - 1 );
+        for( int j = 0; j < nmapw ; j++ )
+        {
+            double w = wmin + dw * ( 1.0 * j ) / ( nmapw - 1 );
+            int k = i * nmapw + j;
+
             double len = numeric_limits<double>::max( );
 
             // apply curvature based limits
@@ -172,9 +193,8 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
             len = max( len, m_GridDensityPtr->m_MinLen() );
 
             // apply sources
-            vec3d p = m_SurfCore.CompPnt( u, w );
-            double grid_len = m_GridDensityPtr->GetTargetLen( p, limitFlag );
-            len = min( len, grid_len );
+            vec3d p( px[k], py[k], pz[k] );
+            len = min( len, grid_len_vec[k] );
 
             // finally check max size
             len = min( len, m_GridDensityPtr->GetBaseLen( limitFlag ) );
@@ -407,6 +427,41 @@ void Surf::LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap )
     }
 }
 
+uint64_t Surf::ComputeRemeshFingerprint()
+{
+    MeshFingerprint fp;
+
+    m_SurfCore.AddFingerprint( fp );
+
+    fp.Add( m_FlipFlag );
+
+    fp.Add( m_NumMap );
+    for ( int i = 0 ; i < ( int )m_SrcMap.size() ; i++ )
+    {
+        fp.Add( ( int )m_SrcMap[i].size() );
+        for ( int j = 0 ; j < ( int )m_SrcMap[i].size() ; j++ )
+        {
+            fp.Add( m_SrcMap[i][j].m_str );
+        }
+    }
+
+    fp.Add( m_ScaleUFlag );
+    fp.Add( ( int )m_UScaleMap.size() );
+    for ( int i = 0 ; i < ( int )m_UScaleMap.size() ; i++ )
+    {
+        fp.Add( m_UScaleMap[i] );
+    }
+    fp.Add( ( int )m_WScaleMap.size() );
+    for ( int i = 0 ; i < ( int )m_WScaleMap.size() ; i++ )
+    {
+        fp.Add( m_WScaleMap[i] );
+    }
+
+    m_Mesh.AddFingerprint( fp );
+
+    return fp.Get();
+}
+
 double Surf::InterpTargetMap( double u, double w )
 {
     int i, j;
@@ -626,10 +681,9 @@ void Surf::WriteSTL( const char* filename )
     m_Mesh.WriteSTL( filename );
 }
 
-void Surf::Intersect( Surf* surfPtr )
+//==== Patch Pairs Whose Boxes Overlap, In The Order Of A Nested Scan ====//
+void Surf::FindIntersectPatchPairs( Surf* surfPtr, vector< pair< SurfPatch*, SurfPatch* > > & patch_pairs )
 {
-    int i;
-
     if ( surfPtr->GetCompID() == m_CompID )
     {
         return;
@@ -648,16 +702,15 @@ void Surf::Intersect( Surf* surfPtr )
         return;
     }
 
-    vector< SurfPatch* > otherPatchVec = surfPtr->GetPatchVec();
-    for ( i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
+    vector< SurfPatch* >& otherPatchVec = surfPtr->GetPatchVec();
+    vector< int > other_ind;
+    for ( int i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
         if ( Compare( *m_PatchVec[i]->get_bbox(), surfPtr->GetBBox() ) )
         {
-            for ( int j = 0 ; j < ( int )otherPatchVec.size() ; j++ )
+            surfPtr->m_PatchTree.FindOverlaps( *m_PatchVec[i]->get_bbox(), other_ind );
+            for ( int j = 0 ; j < ( int )other_ind.size() ; j++ )
             {
-                if ( Compare( *m_PatchVec[i]->get_bbox(), *otherPatchVec[j]->get_bbox() ) )
-                {
-                    intersect( *m_PatchVec[i], *otherPatchVec[j], 0 );
-                }
+                patch_pairs.push_back( make_pair( m_PatchVec[i], otherPatchVec[ other_ind[j] ] ) );
             }
         }
 }
@@ -692,7 +745,7 @@ void Surf::IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_va
 
     double tparm, uparm, vparm;
     list< Tri* >::iterator t;
-    list <Tri*> triList = m_Mesh.GetTriList();
+    list <Tri*>& triList = m_Mesh.GetTriList();
 
     vec3d dir = p1 - p0;
 
@@ -17,6 +17,7 @@
 #include "Mesh.h"
 #include "GridDensity.h"
 #include "SurfPatch.h"
+#include "BndBoxTree.h"
 #include "MapSource.h"
 #include "SurfCore.h"
 
@@ -64,6 +65,9 @@ public:
     void LimitTargetMap();
     void LimitTargetMap( MSCloud &es_cloud, MSTree &es_tree, double minmap );
     double InterpTargetMap( double u, double w );
+
+    //==== Hash Of Everything Mesh::Remesh Reads For This Surface ====//
+    uint64_t ComputeRemeshFingerprint();
     void UWtoTargetMapij( double u, double w, int &i, int &j, double &fraci, double &fracj );
     void UWtoTargetMapij( double u, double w, int &i, int &j );
 
@@ -141,7 +145,7 @@ public:
         return &m_Mesh;
     }
 
-    void Intersect( Surf* surfPtr );
+    void FindIntersectPatchPairs( Surf* surfPtr, vector< pair< SurfPatch*, SurfPatch* > > & patch_pairs );
     void IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals );
     void IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_vals );
 
@@ -161,6 +165,13 @@ public:
     void SetPatchVec( const vector< SurfPatch* > &pvec )
     {
         m_PatchVec = pvec;
+
+        vector< BndBox > patch_boxes( m_PatchVec.size() );
+        for ( int i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
+        {
+            patch_boxes[i] = *m_PatchVec[i]->get_bbox();
+        }
+        m_PatchTree.Build( patch_boxes );
     }
 
     void InitMesh( vector< ISegChain* > chains );
@@ -261,6 +272,7 @@ protected:
 
     BndBox m_BBox;
     vector< SurfPatch* > m_PatchVec;
+    BndBoxTree m_PatchTree;     // Patch bounding boxes, for broad phase intersection
 
     vector< SCurve* > m_SCurveVec;
 
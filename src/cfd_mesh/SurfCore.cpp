@@ -320,6 +320,45 @@ bool SurfCore::LessThanY( double val ) const
     return true;
 }
 
+//==== Hash Parameter Range And Every Control Point ====//
+void SurfCore::AddFingerprint( MeshFingerprint & fp ) const
+{
+    piecewise_surface_type::index_type ip, jp, nupatch, nvpatch;
+    nupatch = m_Surface.number_u_patches();
+    nvpatch = m_Surface.number_v_patches();
+
+    fp.Add( ( int )nupatch );
+    fp.Add( ( int )nvpatch );
+    fp.Add( GetMinU() );
+    fp.Add( GetMaxU() );
+    fp.Add( GetMinW() );
+    fp.Add( GetMaxW() );
+
+    for( ip = 0; ip < nupatch; ++ip )
+    {
+        for( jp = 0; jp < nvpatch; ++jp )
+        {
+            surface_patch_type::index_type icp, jcp;
+            const surface_patch_type *patch = m_Surface.get_patch( ip, jp );
+
+            fp.Add( ( int )patch->degree_u() );
+            fp.Add( ( int )patch->degree_v() );
+
+            for( icp = 0; icp <= patch->degree_u(); ++icp )
+            {
+                for( jcp = 0; jcp <= patch->degree_v(); ++jcp )
+                {
+                    surface_point_type cp;
+                    cp = patch->get_control_point( icp, jcp );
+                    fp.Add( cp.x() );
+                    fp.Add( cp.y() );
+                    fp.Add( cp.z() );
+                }
+            }
+        }
+    }
+}
+
 bool SurfCore::PlaneAtYZero() const
 {
     double tol = 1.0e-6;
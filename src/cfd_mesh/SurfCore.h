@@ -7,6 +7,7 @@
 #define SURF_CORE__INCLUDED_
 
 #include "Vec3d.h"
+#include "MeshFingerprint.h"
 
 #include "eli/code_eli.hpp"
 
@@ -100,6 +101,8 @@ public:
     bool LessThanY( double val ) const;
     bool PlaneAtYZero() const;
 
+    void AddFingerprint( MeshFingerprint & fp ) const;
+
     Bezier_curve GetBorderCurve( int iborder ) const;
     void LoadBorderCurves( vector < Bezier_curve > & borderCurves ) const;
 
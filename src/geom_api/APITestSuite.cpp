@@ -7,6 +7,7 @@
 
 #include "VSP_Geom_API.h"
 #include "APITestSuite.h"
+#include "LinkMgr.h"
 #include <float.h>
 
 //Default tolerance to use for tests.  Most calculations are done as doubles and choosing single precision FLT_MIN gives some allowance for precision stackup in calculations
@@ -121,6 +122,54 @@ void APITestSuite::ChangePodParams()
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
 }
 
+//==== Set Several Parms With One Link Pass And One Update ====//
+void APITestSuite::BatchParmSets()
+{
+    printf("APITestSuite::BatchParmSets()\n");
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string pod_a = vsp::AddGeom( "POD" );
+    string pod_b = vsp::AddGeom( "POD" );
+    string len_a = vsp::GetParm( pod_a, "Length", "Design" );
+    string len_b = vsp::GetParm( pod_b, "Length", "Design" );
+    string x_a = vsp::GetParm( pod_a, "X_Rel_Location", "XForm" );
+    string x_b = vsp::GetParm( pod_b, "X_Rel_Location", "XForm" );
+    vsp::Update();
+
+    //==== Pod B Length Follows Pod A Length ====//
+    LinkMgr.AddLink( len_a, len_b );
+
+    //==== Links Wait For The Commit ====//
+    vsp::BeginParmBatch();
+    vsp::SetParmVal( len_a, 12.0 );
+    vsp::SetParmVal( x_a, 2.0 );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_b ), 10.0, TEST_TOL );
+    vsp::CommitParmBatch();
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_b ), 12.0, TEST_TOL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Same Result As One At A Time Sets ====//
+    vector< string > parm_vec;
+    parm_vec.push_back( len_a );
+    parm_vec.push_back( x_b );
+    vector< double > val_vec;
+    val_vec.push_back( 8.0 );
+    val_vec.push_back( 3.0 );
+    vector< double > ret_vec = vsp::SetParmVals( parm_vec, val_vec );
+    TEST_ASSERT( ret_vec.size() == 2 );
+    TEST_ASSERT_DELTA( ret_vec[0], 8.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( len_b ), 8.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( x_b ), 3.0, TEST_TOL );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Mismatched Inputs Are An Error ====//
+    val_vec.pop_back();
+    vsp::SetParmVals( parm_vec, val_vec );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+}
+
 //==== Use Case 1 =====//
 void APITestSuite::CopyPasteGeometry()
 {
@@ -272,6 +321,63 @@ void APITestSuite::TestAnalysesWithPod()
 
 }
 
+void APITestSuite::TestProjectionUnion()
+{
+    printf( "APITestSuite::TestProjectionUnion()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+
+    //==== Overlapping Wing, Fuselage And Pod =====//
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "TotalSpan", "WingGeom", 30.0 ), 30.0, TEST_TOL );
+    string fus_id = vsp::AddGeom( "FUSELAGE" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( fus_id, "X_Rel_Location", "XForm", -9.0 ), -9.0, TEST_TOL );
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "Y_Rel_Location", "XForm", 5.0 ), 5.0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string analysis_name = "Projection";
+    vsp::SetAnalysisInputDefaults( analysis_name );
+
+    vector < vec3d > dir_vec;
+    dir_vec.push_back( vec3d( 1.0, 0.0, 0.0 ) );
+    dir_vec.push_back( vec3d( 0.0, 1.0, 0.0 ) );
+    dir_vec.push_back( vec3d( 0.0, 0.0, 1.0 ) );
+    dir_vec.push_back( vec3d( 1.0, 1.0, 1.0 ) / sqrt( 3.0 ) );
+    vsp::SetVec3dAnalysisInput( analysis_name, "BatchDirections", dir_vec );
+
+    //==== Every Path In One Clipper Union ====//
+    vsp::SetIntAnalysisInput( analysis_name, "UnionBatchSize", vector < int > ( 1, 100000000 ) );
+    string single_id = vsp::ExecAnalysis( analysis_name );
+    TEST_ASSERT( single_id.size() > 0 );
+    vector < double > single_area = vsp::GetDoubleResults( single_id, "Area" );
+
+    //==== Small Batches, Merged Pairwise ====//
+    vsp::SetIntAnalysisInput( analysis_name, "UnionBatchSize", vector < int > ( 1, 16 ) );
+    string tiled_id = vsp::ExecAnalysis( analysis_name );
+    TEST_ASSERT( tiled_id.size() > 0 );
+    vector < double > tiled_area = vsp::GetDoubleResults( tiled_id, "Area" );
+
+    TEST_ASSERT( single_area.size() == dir_vec.size() );
+    TEST_ASSERT( tiled_area.size() == dir_vec.size() );
+    for ( int i = 0 ; i < ( int )single_area.size() && i < ( int )tiled_area.size() ; i++ )
+    {
+        TEST_ASSERT( single_area[i] > 0.0 );
+        TEST_ASSERT_DELTA( tiled_area[i], single_area[i], 1e-6 * single_area[i] );
+    }
+
+    //==== Batch Directions Are Not Supported With A Boundary ====//
+    vsp::SetIntAnalysisInput( analysis_name, "BoundaryType", vector < int > ( 1, vsp::GEOM_BOUNDARY ) );
+    vsp::SetStringAnalysisInput( analysis_name, "BoundaryGeomID", vector < string > ( 1, pod_id ) );
+    TEST_ASSERT( vsp::ExecAnalysis( analysis_name ).empty() );
+
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    printf( "\n" );
+}
+
 void APITestSuite::TestDXFExport()
 {
     printf( "APITestSuite::TestDXFExport()\n" );
@@ -24,10 +24,12 @@ public:
         // Geometry manipulation
         TEST_ADD( APITestSuite::CreateGeometry )
         TEST_ADD( APITestSuite::ChangePodParams )
+        TEST_ADD( APITestSuite::BatchParmSets )
         TEST_ADD( APITestSuite::CopyPasteGeometry )
         // Analysis
         TEST_ADD( APITestSuite::CheckAnalysisMgr )
         TEST_ADD( APITestSuite::TestAnalysesWithPod )
+        TEST_ADD( APITestSuite::TestProjectionUnion )
 
         // Export
         TEST_ADD( APITestSuite::TestDXFExport )
@@ -43,10 +45,12 @@ private:
     // Geometry manipulation
     void CreateGeometry();
     void ChangePodParams();
+    void BatchParmSets();
     void CopyPasteGeometry();
     // Analysis
     void CheckAnalysisMgr();
     void TestAnalysesWithPod();
+    void TestProjectionUnion();
     // Export
     void TestDXFExport();
     void TestSVGExport();
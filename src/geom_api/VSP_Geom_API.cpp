@@ -2804,6 +2804,66 @@ double SetParmValUpdate( const string & geom_id, const string & parm_name, const
     return p->SetFromDevice( val );         // Force Update
 }
 
+/// Start a batch of parm sets.  Until the batch is committed, SetParmVal
+/// only stores values - links are not followed and nothing is updated.
+/// Batches may nest; only the outermost commit applies them.
+void BeginParmBatch()
+{
+    LinkMgr.BeginBatch();
+    ErrorMgr.NoError();
+}
+
+/// Apply the links of every parm set since BeginParmBatch in one pass,
+/// then update the vehicle once.  Links are followed after all values are
+/// set, so a linked parm follows its source even if it was also set.
+void CommitParmBatch()
+{
+    if ( LinkMgr.EndBatch() )
+    {
+        Vehicle* veh = GetVehicle();
+        veh->Update();
+        veh->ParmChanged( NULL, Parm::SET );        // BBox And GUI
+    }
+    ErrorMgr.NoError();
+}
+
+/// Set many parm values as a single batch.
+/// The final values of the parms are returned.
+vector<double> SetParmVals( const vector<string> & parm_ids, const vector<double> & vals )
+{
+    vector<double> ret_vec;
+    if ( parm_ids.size() != vals.size() )
+    {
+        ErrorMgr.AddError( VSP_INDEX_OUT_RANGE, "SetParmVals::Number Of Parms And Values Differ" );
+        return ret_vec;
+    }
+
+    ret_vec.resize( vals.size() );
+
+    BeginParmBatch();
+    string missing_id;
+    for ( int i = 0 ; i < ( int )parm_ids.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( parm_ids[i] );
+        if ( p )
+        {
+            ret_vec[i] = p->Set( vals[i] );
+        }
+        else
+        {
+            ret_vec[i] = vals[i];
+            missing_id = parm_ids[i];
+        }
+    }
+    CommitParmBatch();
+
+    if ( !missing_id.empty() )
+    {
+        ErrorMgr.AddError( VSP_CANT_FIND_PARM, "SetParmVals::Can't Find Parm " + missing_id );
+    }
+    return ret_vec;
+}
+
 /// Get the value of parm
 double GetParmVal( const string & parm_id )
 {
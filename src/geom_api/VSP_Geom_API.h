@@ -211,6 +211,9 @@ extern double SetParmVal( const std::string & geom_id, const std::string & name,
 extern double SetParmValLimits( const std::string & parm_id, double val, double lower_limit, double upper_limit );
 extern double SetParmValUpdate( const std::string & parm_id, double val );
 extern double SetParmValUpdate( const std::string & geom_id, const std::string & parm_name, const std::string & parm_group_name, double val );
+extern void BeginParmBatch();
+extern void CommitParmBatch();
+extern std::vector<double> SetParmVals( const std::vector<std::string> & parm_ids, const std::vector<double> & vals );
 extern double GetParmVal( const std::string & parm_id );
 extern double GetParmVal( const std::string & geom_id, const std::string & name, const std::string & group );
 extern int GetIntParmVal( const std::string & parm_id );
@@ -731,6 +731,9 @@ bool FileAirfoil::ReadFile( string file_name )
 
     fclose( file_id );
 
+    //==== Points Are Not Parms - Mark Curve And Owning Geom For Update ====//
+    ParmChanged( NULL, Parm::SET );
+
     return valid_file;
 
 }
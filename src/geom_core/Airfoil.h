@@ -216,6 +216,7 @@ public:
     {
         m_UpperPnts = up_pnt_vec;
         m_LowerPnts = low_pnt_vec;
+        ParmChanged( NULL, Parm::SET );
     }
 
     virtual void ReadV2File( xmlNodePtr &root );
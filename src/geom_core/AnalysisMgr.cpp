@@ -783,6 +783,13 @@ void ProjectionAnalysis::SetDefaults()
     m_Inputs.Add( NameValData( "DirectionGeomID", "" ) );
 
     m_Inputs.Add( NameValData( "Direction", vec3d( 1.0, 0.0, 0.0 ) ) );
+
+    // Projected area along each of these directions, only valid without a boundary.
+    vector < vec3d > batch_dir_vec;
+    m_Inputs.Add( NameValData( "BatchDirections", batch_dir_vec ) );
+
+    m_Inputs.Add( NameValData( "ClipperRange", ProjectionMgr.GetClipperRange() ) );
+    m_Inputs.Add( NameValData( "UnionBatchSize", ProjectionMgr.GetUnionBatchSize() ) );
 }
 
 
@@ -858,41 +865,87 @@ string ProjectionAnalysis::Execute()
         dir = ProjectionMgr.GetDirection( directionType, directionGeomID );
     }
 
+    vector < vec3d > batch_dir_vec;
+    nvd = m_Inputs.FindPtr( "BatchDirections", 0 );
+    if ( nvd )
+    {
+        batch_dir_vec = nvd->GetVec3dData();
+    }
+
+    if ( !batch_dir_vec.empty() && boundaryType != vsp::NO_BOUNDARY )
+    {
+        printf( "ERROR: Projection BatchDirections can not be used with a boundary\n" );
+        return string();
+    }
+
+    //==== Clipper Tuning Only Applies To This Run ====//
+    double old_clipper_range = ProjectionMgr.GetClipperRange();
+    int old_union_batch_size = ProjectionMgr.GetUnionBatchSize();
+
+    nvd = m_Inputs.FindPtr( "ClipperRange", 0 );
+    if ( nvd )
+    {
+        ProjectionMgr.SetClipperRange( nvd->GetDouble( 0 ) );
+    }
+
+    nvd = m_Inputs.FindPtr( "UnionBatchSize", 0 );
+    if ( nvd )
+    {
+        ProjectionMgr.SetUnionBatchSize( nvd->GetInt( 0 ) );
+    }
+
     Results* res = NULL;
 
-    switch ( boundaryType )
+    if ( !batch_dir_vec.empty() )
     {
-        case vsp::NO_BOUNDARY:
-            if ( targetType == vsp::SET_TARGET )
-            {
-                res = ProjectionMgr.Project( targetSet, dir );
-            }
-            else
-            {
-                res = ProjectionMgr.Project( targetGeomID, dir );
-            }
-            break;
-        case vsp::SET_BOUNDARY:
-            if ( targetType == vsp::SET_TARGET )
-            {
-                res = ProjectionMgr.Project( targetSet, boundarySet, dir );
-            }
-            else
-            {
-                res = ProjectionMgr.Project( targetGeomID, boundarySet, dir );
-            }
-            break;
-        case vsp::GEOM_BOUNDARY:
-            if ( targetType == vsp::SET_TARGET )
-            {
-                res = ProjectionMgr.Project( targetSet, boundaryGeomID, dir );
-            }
-            else
-            {
-                res = ProjectionMgr.Project( targetGeomID, boundaryGeomID, dir );
-            }
-            break;
+        if ( targetType == vsp::SET_TARGET )
+        {
+            res = ProjectionMgr.ProjectAreas( targetSet, batch_dir_vec );
+        }
+        else
+        {
+            res = ProjectionMgr.ProjectAreas( targetGeomID, batch_dir_vec );
+        }
     }
+    else
+    {
+        switch ( boundaryType )
+        {
+            case vsp::NO_BOUNDARY:
+                if ( targetType == vsp::SET_TARGET )
+                {
+                    res = ProjectionMgr.Project( targetSet, dir );
+                }
+                else
+                {
+                    res = ProjectionMgr.Project( targetGeomID, dir );
+                }
+                break;
+            case vsp::SET_BOUNDARY:
+                if ( targetType == vsp::SET_TARGET )
+                {
+                    res = ProjectionMgr.Project( targetSet, boundarySet, dir );
+                }
+                else
+                {
+                    res = ProjectionMgr.Project( targetGeomID, boundarySet, dir );
+                }
+                break;
+            case vsp::GEOM_BOUNDARY:
+                if ( targetType == vsp::SET_TARGET )
+                {
+                    res = ProjectionMgr.Project( targetSet, boundaryGeomID, dir );
+                }
+                else
+                {
+                    res = ProjectionMgr.Project( targetGeomID, boundaryGeomID, dir );
+                }
+                break;
+        }
+    }
+
+    ProjectionMgr.SetClipperRange( old_clipper_range );
+    ProjectionMgr.SetUnionBatchSize( old_union_batch_size );
 
     if ( !res )
     {
@@ -304,6 +304,7 @@ xmlNodePtr GeomBase::DecodeXml( xmlNodePtr & node )
         //m_Type.m_Type   = XmlUtil::FindInt( child_node, "TypeID", m_Type.m_Type );
         m_Type.m_FixedFlag = !!XmlUtil::FindInt( child_node, "TypeFixed", m_Type.m_FixedFlag );
         m_ParentID = ParmMgr.RemapID( XmlUtil::FindString( child_node, "ParentID", m_ParentID ) );
+        m_LateUpdateFlag = true;
 
         m_ChildIDVec.clear();
 
@@ -743,6 +744,11 @@ Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
 {
     m_UpdateBlock = false;
 
+    m_UpdateSig = 0;
+    m_FullUpdateFlag = false;
+
+    m_PreTessValid = false;
+
     m_Name = "Geom";
     m_Type.m_Type = GEOM_GEOM_TYPE;
     m_Type.m_Name = m_Name;
@@ -959,15 +965,85 @@ void Geom::Update( bool fullupdate )
     UpdateChildren( fullupdate );
     UpdateBBox();
 
-    if ( fullupdate )
+    //==== Vehicle May Collect Draw Objects To Tessellate Concurrently ====//
+    if ( fullupdate && !m_Vehicle->DeferDrawObj( this ) )
     {
         UpdateDrawObj();
     }
 
+    //==== Parms Set By The Update Itself Do Not Make It Dirty Again ====//
+    m_LateUpdateFlag = false;
+    m_UpdateSig = ComputeUpdateSig();
+    m_FullUpdateFlag = fullupdate;
+
     m_UpdatedParmVec.clear();
     m_UpdateBlock = false;
 }
 
+//==== Hash Of Linkable Parm IDs And Their Change Counts ====//
+size_t Geom::ComputeUpdateSig()
+{
+    vector< string > parm_vec;
+    AddLinkableParms( parm_vec );
+
+    std::hash< string > str_hash;
+    size_t sig = parm_vec.size();
+    for ( int i = 0 ; i < ( int )parm_vec.size() ; i++ )
+    {
+        sig = sig * 31 + str_hash( parm_vec[i] );
+
+        Parm* p = ParmMgr.FindParm( parm_vec[i] );
+        if ( p )
+        {
+            sig = sig * 31 + ( size_t )p->GetChangeCnt();
+        }
+    }
+    return sig;
+}
+
+//==== Needs Update If Flagged, Or A Parm Here Or In XSecs/SubSurfs Changed ====//
+bool Geom::IsUpdateDirty( bool fullupdate )
+{
+    if ( m_LateUpdateFlag )
+    {
+        return true;
+    }
+
+    if ( fullupdate && !m_FullUpdateFlag )
+    {
+        return true;
+    }
+
+    return ComputeUpdateSig() != m_UpdateSig;
+}
+
+//==== Update Dirty Geom With Its Subtree, Otherwise Look For Dirty Children ====//
+void Geom::UpdateDirty( bool fullupdate, int & num_updated, int & num_skipped )
+{
+    if ( IsUpdateDirty( fullupdate ) )
+    {
+        vector< string > id_vec;
+        LoadIDAndChildren( id_vec );
+        num_updated += ( int )id_vec.size();
+
+        Update( fullupdate );
+        return;
+    }
+
+    num_skipped++;
+
+    for ( int i = 0 ; i < ( int )m_ChildIDVec.size() ; i++ )
+    {
+        Geom* child = m_Vehicle->FindGeom( m_ChildIDVec[i] );
+        if ( child )
+        {
+            child->m_ignoreAbsFlag = true;
+            child->UpdateDirty( fullupdate, num_updated, num_skipped );
+            child->m_ignoreAbsFlag = false;
+        }
+    }
+}
+
 void Geom::UpdateTesselate( int indx, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &norms,
                             vector< vector< vec3d > > &uw_pnts, bool degen )
 {
@@ -1873,20 +1949,69 @@ void Geom::WriteProjectionLinesSVG( xmlNodePtr root, const BndBox &svgbox )
     }
 }
 
+//==== Tessellate Surfaces Into Draw Objects Ahead Of UpdateDrawObj ====//
+void Geom::PreTessDrawObj()
+{
+    if ( m_SurfVec.empty() )
+    {
+        return;
+    }
+
+    TessSurfDrawObj( m_PreTessWireShadeVec, m_PreTessFeature );
+    m_PreTessValid = true;
+}
+
 void Geom::UpdateDrawObj()
 {
     m_FeatureDrawObj_vec.clear();
     m_FeatureDrawObj_vec.resize(1);
-    m_FeatureDrawObj_vec[0].m_GeomChanged = true;
+
+    //==== Reuse Tessellation From PreTessDrawObj If Available ====//
+    if ( m_PreTessValid )
+    {
+        m_WireShadeDrawObj_vec.swap( m_PreTessWireShadeVec );
+        m_FeatureDrawObj_vec[0] = m_PreTessFeature;
+
+        m_PreTessWireShadeVec.clear();
+        m_PreTessFeature = DrawObj();
+        m_PreTessValid = false;
+    }
+    else
+    {
+        TessSurfDrawObj( m_WireShadeDrawObj_vec, m_FeatureDrawObj_vec[0] );
+    }
+
+    //==== Bounding Box ====//
+    m_HighlightDrawObj.m_PntVec = m_BBox.GetBBoxDrawLines();
+
+    //=== Axis ===//
+    m_AxisDrawObj_vec.clear();
+    m_AxisDrawObj_vec.resize( 3 );
+    for ( int i = 0; i < 3; i++ )
+    {
+        MakeDashedLine( m_AttachOrigin,  m_AttachAxis[i], 4, m_AxisDrawObj_vec[i].m_PntVec );
+        vec3d c;
+        c.v[i] = 1.0;
+        m_AxisDrawObj_vec[i].m_LineColor = c;
+        m_AxisDrawObj_vec[i].m_GeomChanged = true;
+    }
+
+}
+
+//==== Tessellate Surfaces - Reads And Writes Only This Geom's Own Data ====//
+void Geom::TessSurfDrawObj( vector< DrawObj > & wire_shade_vec, DrawObj & feature_obj )
+{
+    feature_obj.m_PntVec.clear();
+    feature_obj.m_GeomChanged = true;
 
     double tol = 1e-2;
 
-    m_WireShadeDrawObj_vec.clear();
-    m_WireShadeDrawObj_vec.resize( 2 );
-    m_WireShadeDrawObj_vec[0].m_FlipNormals = false;
-    m_WireShadeDrawObj_vec[1].m_FlipNormals = true;
-    m_WireShadeDrawObj_vec[0].m_GeomChanged = true;
-    m_WireShadeDrawObj_vec[1].m_GeomChanged = true;
+    wire_shade_vec.clear();
+    wire_shade_vec.resize( 2 );
+    wire_shade_vec[0].m_FlipNormals = false;
+    wire_shade_vec[1].m_FlipNormals = true;
+    wire_shade_vec[0].m_GeomChanged = true;
+    wire_shade_vec[1].m_GeomChanged = true;
 
     //==== Tesselate Surface ====//
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
@@ -1907,14 +2032,14 @@ void Geom::UpdateDrawObj()
             iflip = 1;
         }
 
-        m_WireShadeDrawObj_vec[iflip].m_PntMesh.insert( m_WireShadeDrawObj_vec[iflip].m_PntMesh.end(),
+        wire_shade_vec[iflip].m_PntMesh.insert( wire_shade_vec[iflip].m_PntMesh.end(),
                 pnts.begin(), pnts.end() );
-        m_WireShadeDrawObj_vec[iflip].m_NormMesh.insert( m_WireShadeDrawObj_vec[iflip].m_NormMesh.end(),
+        wire_shade_vec[iflip].m_NormMesh.insert( wire_shade_vec[iflip].m_NormMesh.end(),
                 norms.begin(), norms.end() );
 
-        m_WireShadeDrawObj_vec[iflip].m_uTexMesh.insert( m_WireShadeDrawObj_vec[iflip].m_uTexMesh.end(),
+        wire_shade_vec[iflip].m_uTexMesh.insert( wire_shade_vec[iflip].m_uTexMesh.end(),
                 utex.begin(), utex.end() );
-        m_WireShadeDrawObj_vec[iflip].m_vTexMesh.insert( m_WireShadeDrawObj_vec[iflip].m_vTexMesh.end(),
+        wire_shade_vec[iflip].m_vTexMesh.insert( wire_shade_vec[iflip].m_vTexMesh.end(),
                 vtex.begin(), vtex.end() );
 
         if( m_GuiDraw.GetDispFeatureFlag() )
@@ -1927,12 +2052,12 @@ void Geom::UpdateDrawObj()
 
                 int n = ptline.size() - 1;
 
-                m_FeatureDrawObj_vec[0].m_PntVec.reserve( m_FeatureDrawObj_vec[0].m_PntVec.size() + 2 * n );
+                feature_obj.m_PntVec.reserve( feature_obj.m_PntVec.size() + 2 * n );
 
                 for ( int k = 0; k < n; k++ )
                 {
-                    m_FeatureDrawObj_vec[0].m_PntVec.push_back( ptline[ k ] );
-                    m_FeatureDrawObj_vec[0].m_PntVec.push_back( ptline[ k + 1 ] );
+                    feature_obj.m_PntVec.push_back( ptline[ k ] );
+                    feature_obj.m_PntVec.push_back( ptline[ k + 1 ] );
                 }
             }
 
@@ -1944,32 +2069,16 @@ void Geom::UpdateDrawObj()
 
                 int n = ptline.size() - 1;
 
-                m_FeatureDrawObj_vec[0].m_PntVec.reserve( m_FeatureDrawObj_vec[0].m_PntVec.size() + 2 * n );
+                feature_obj.m_PntVec.reserve( feature_obj.m_PntVec.size() + 2 * n );
 
                 for ( int k = 0; k < n; k++ )
                 {
-                    m_FeatureDrawObj_vec[0].m_PntVec.push_back( ptline[ k ] );
-                    m_FeatureDrawObj_vec[0].m_PntVec.push_back( ptline[ k + 1 ] );
+                    feature_obj.m_PntVec.push_back( ptline[ k ] );
+                    feature_obj.m_PntVec.push_back( ptline[ k + 1 ] );
                 }
             }
         }
     }
-
-    //==== Bounding Box ====//
-    m_HighlightDrawObj.m_PntVec = m_BBox.GetBBoxDrawLines();
-
-    //=== Axis ===//
-    m_AxisDrawObj_vec.clear();
-    m_AxisDrawObj_vec.resize( 3 );
-    for ( int i = 0; i < 3; i++ )
-    {
-        MakeDashedLine( m_AttachOrigin,  m_AttachAxis[i], 4, m_AxisDrawObj_vec[i].m_PntVec );
-        vec3d c;
-        c.v[i] = 1.0;
-        m_AxisDrawObj_vec[i].m_LineColor = c;
-        m_AxisDrawObj_vec[i].m_GeomChanged = true;
-    }
-
 }
 
 //==== Encode Data Into XML Data Struct ====//
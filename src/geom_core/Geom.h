@@ -195,6 +195,7 @@ public:
     virtual void SetParentID( string id )
     {
         m_ParentID = id ;
+        m_LateUpdateFlag = true;
     }
     virtual string GetParentID()
     {
@@ -335,6 +336,21 @@ public:
     virtual void Update( bool fullupdate = true );
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
+    //==== Dirty Tracking - Update Only Geoms Whose Inputs Changed ====//
+    virtual bool IsUpdateDirty( bool fullupdate );
+    virtual void UpdateDirty( bool fullupdate, int & num_updated, int & num_skipped );
+
+    //==== Surface Tessellation Of UpdateDrawObj - May Run On A Worker Thread ====//
+    virtual void PreTessDrawObj();
+    virtual bool UsesPreTess()      // False if UpdateDrawObj does not go through Geom::UpdateDrawObj
+    {
+        return true;
+    }
+    void UpdateDeferredDrawObj()
+    {
+        UpdateDrawObj();
+    }
+
     virtual void SetColor( int r, int g, int b );
     virtual vec3d GetColor();
 
@@ -599,6 +615,15 @@ protected:
 
     bool m_UpdateBlock;
 
+    virtual size_t ComputeUpdateSig();
+    size_t m_UpdateSig;             // Linkable parm IDs and change counts after the last Update
+    bool m_FullUpdateFlag;          // Last Update also rebuilt feature lines and draw objects
+
+    virtual void TessSurfDrawObj( vector< DrawObj > & wire_shade_vec, DrawObj & feature_obj );
+    bool m_PreTessValid;            // PreTessDrawObj results waiting for UpdateDrawObj
+    vector< DrawObj > m_PreTessWireShadeVec;
+    DrawObj m_PreTessFeature;
+
     virtual void UpdateSurf() = 0;
     void UpdateEndCaps();
     virtual void UpdateFeatureLines();
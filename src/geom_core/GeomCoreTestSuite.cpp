@@ -7,7 +7,11 @@
 
 #include "GeomCoreTestSuite.h"
 #include "MeshGeom.h"
+#include "MeshSlicer.h"
+#include "ParallelUtil.h"
 #include "StlHelper.h"
+#include "XSecSurf.h"
+#include "XSecCurve.h"
 
 
 //==== Test GeomXForm ====//
@@ -122,6 +126,142 @@ void GeomCoreTestSuite::VehicleTest()
 
 }
 
+//==== Test Dirty Tracking In Vehicle Update ====//
+void GeomCoreTestSuite::DirtyUpdateTest()
+{
+    Vehicle veh;
+    GeomType type;
+    type.m_Name = "POD";
+
+    string id0 = veh.AddGeom( type );
+    veh.ClearActiveGeom();
+    string id1 = veh.AddGeom( type );
+    veh.ClearActiveGeom();
+
+    veh.AddActiveGeom( id0 );
+    string id2 = veh.AddGeom( type );       // Child of id0
+    veh.ClearActiveGeom();
+
+    veh.ForceUpdate();
+    TEST_ASSERT( veh.GetNumGeomUpdated() == 3 );
+
+    //==== Nothing Changed ====//
+    veh.Update();
+    TEST_ASSERT( veh.GetNumGeomUpdated() == 0 );
+    TEST_ASSERT( veh.GetNumGeomSkipped() == 3 );
+
+    //==== Unrelated Top Geom ====//
+    veh.FindGeom( id1 )->m_XRelLoc.Set( 2.0 );
+    veh.Update();
+    TEST_ASSERT( veh.GetNumGeomUpdated() == 1 );
+    TEST_ASSERT( veh.GetNumGeomSkipped() == 2 );
+
+    //==== Parent Change Carries To Child ====//
+    veh.FindGeom( id0 )->m_XRelLoc.Set( 3.0 );
+    veh.Update();
+    TEST_ASSERT( veh.GetNumGeomUpdated() == 2 );
+    TEST_ASSERT( veh.GetNumGeomSkipped() == 1 );
+
+    //==== Child Alone ====//
+    veh.FindGeom( id2 )->m_XRelLoc.Set( 1.0 );
+    veh.Update();
+    TEST_ASSERT( veh.GetNumGeomUpdated() == 1 );
+    TEST_ASSERT( veh.GetNumGeomSkipped() == 2 );
+    TEST_ASSERT_DELTA( veh.FindGeom( id2 )->m_XLoc(), 1.0, 1e-12 );
+
+    //==== Dirty Tracking Off ====//
+    veh.SetUpdateDirtyOnlyFlag( false );
+    veh.Update();
+    TEST_ASSERT( veh.GetNumGeomUpdated() == 3 );
+    TEST_ASSERT( veh.GetNumGeomSkipped() == 0 );
+    veh.SetUpdateDirtyOnlyFlag( true );
+
+    //==== XSec Points Changed, Width And Height Unchanged ====//
+    type.m_Name = "FUSELAGE";
+    string id3 = veh.AddGeom( type );
+    veh.ClearActiveGeom();
+    Geom* fuse = veh.FindGeom( id3 );
+    XSecSurf* xsec_surf = fuse->GetXSecSurf( 0 );
+    xsec_surf->ChangeXSecShape( 2, vsp::XS_FILE_FUSE );
+    FileXSec* file_xs = dynamic_cast< FileXSec* >( xsec_surf->FindXSec( 2 )->GetXSecCurve() );
+    TEST_ASSERT( file_xs );
+
+    vector< vec3d > square_vec;
+    square_vec.push_back( vec3d(  0.0,  1.0, 0.0 ) );
+    square_vec.push_back( vec3d(  1.0,  1.0, 0.0 ) );
+    square_vec.push_back( vec3d(  1.0,  0.0, 0.0 ) );
+    square_vec.push_back( vec3d(  1.0, -1.0, 0.0 ) );
+    square_vec.push_back( vec3d(  0.0, -1.0, 0.0 ) );
+    square_vec.push_back( vec3d( -1.0, -1.0, 0.0 ) );
+    square_vec.push_back( vec3d( -1.0,  0.0, 0.0 ) );
+    square_vec.push_back( vec3d( -1.0,  1.0, 0.0 ) );
+
+    vector< vec3d > diamond_vec;
+    diamond_vec.push_back( vec3d(  0.0,  1.0, 0.0 ) );
+    diamond_vec.push_back( vec3d(  0.5,  0.5, 0.0 ) );
+    diamond_vec.push_back( vec3d(  1.0,  0.0, 0.0 ) );
+    diamond_vec.push_back( vec3d(  0.5, -0.5, 0.0 ) );
+    diamond_vec.push_back( vec3d(  0.0, -1.0, 0.0 ) );
+    diamond_vec.push_back( vec3d( -0.5, -0.5, 0.0 ) );
+    diamond_vec.push_back( vec3d( -1.0,  0.0, 0.0 ) );
+    diamond_vec.push_back( vec3d( -0.5,  0.5, 0.0 ) );
+
+    file_xs->SetPnts( square_vec );
+    veh.Update();
+    double width = file_xs->GetWidth();
+    double height = file_xs->GetHeight();
+    vec3d square_pnt = fuse->GetSurfPtr( 0 )->CompPnt01( 0.5, 0.125 );
+
+    veh.Update();
+    TEST_ASSERT( veh.GetNumGeomUpdated() == 0 );
+
+    file_xs->SetPnts( diamond_vec );
+    TEST_ASSERT_DELTA( file_xs->GetWidth(), width, 1e-12 );
+    TEST_ASSERT_DELTA( file_xs->GetHeight(), height, 1e-12 );
+    veh.Update();
+    TEST_ASSERT( veh.GetNumGeomUpdated() == 1 );
+    vec3d diamond_pnt = fuse->GetSurfPtr( 0 )->CompPnt01( 0.5, 0.125 );
+    TEST_ASSERT( dist( square_pnt, diamond_pnt ) > 0.1 );
+}
+
+//==== Conformal Geoms Update And Delete A Copy Of Their Parent During Vehicle::Update ====//
+void GeomCoreTestSuite::ConformalUpdateTest()
+{
+    int num_threads = GetNumParallelThreads();
+    SetNumParallelThreads( 4 );             // Defer draw objects even on one core
+
+    Vehicle veh;
+    veh.SetParallelUpdateFlag( true );
+
+    GeomType type;
+    type.m_Name = "WING";
+    string wing_id = veh.AddGeom( type );
+
+    veh.SetActiveGeom( wing_id );
+    type.m_Name = "CONFORMAL";
+    string conf_id = veh.AddGeom( type );
+    veh.ClearActiveGeom();
+
+    int num_geoms = ( int )veh.GetGeomVec().size();
+
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        veh.FindGeom( wing_id )->m_ZRelLoc.Set( 0.1 * ( i + 1 ) );
+        veh.Update();
+        TEST_ASSERT( veh.GetNumGeomUpdated() >= 2 );
+    }
+
+    veh.ForceUpdate();
+
+    //==== Temporary Copies Are Gone And The Conformal Surface Is Built ====//
+    TEST_ASSERT( ( int )veh.GetGeomVec().size() == num_geoms );
+    Geom* conf = veh.FindGeom( conf_id );
+    TEST_ASSERT( conf );
+    TEST_ASSERT( conf->GetNumMainSurfs() > 0 );
+
+    SetNumParallelThreads( num_threads );
+}
+
 //==== Test Pod ====//
 void GeomCoreTestSuite::PodTest()
 {
@@ -241,6 +381,301 @@ void GeomCoreTestSuite::MeshIOTest()
     veh.CutActiveGeomVec();
 }
 
+//==== Closed Box Mesh, Optionally With Inward Facing Tris ====//
+static TMesh* MakeBoxMesh( const vec3d & lo, const vec3d & hi, int prior, bool flip )
+{
+    TMesh* tm = new TMesh();
+    tm->m_MassPrior = prior;
+
+    vec3d p[8];
+    for ( int i = 0 ; i < 8 ; i++ )
+    {
+        p[i] = vec3d( ( i & 1 ) ? hi.x() : lo.x(), ( i & 2 ) ? hi.y() : lo.y(), ( i & 4 ) ? hi.z() : lo.z() );
+    }
+
+    int face[6][4] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 }, { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+    for ( int f = 0 ; f < 6 ; f++ )
+    {
+        int a = face[f][ flip ? 3 : 0 ];
+        int b = face[f][ flip ? 2 : 1 ];
+        int c = face[f][ flip ? 1 : 2 ];
+        int d = face[f][ flip ? 0 : 3 ];
+        tm->AddTri( p[a], p[b], p[c], vec3d() );
+        tm->AddTri( p[a], p[c], p[d], vec3d() );
+    }
+    return tm;
+}
+
+void GeomCoreTestSuite::MeshSliceTest()
+{
+    vector< TMesh* > mesh_vec;
+    mesh_vec.push_back( MakeBoxMesh( vec3d( 0, 0, 0 ), vec3d( 2, 2, 2 ), 0, false ) );
+    mesh_vec.push_back( MakeBoxMesh( vec3d( 1, 1, 1 ), vec3d( 3, 4, 3 ), 1, true ) );
+
+    MeshSlicer slicer;
+    slicer.Build( mesh_vec, vec3d( 1, 0, 0 ) );
+
+    //==== One Box ====//
+    MeshSlice cut;
+    slicer.Slice( 0.5, cut, true );
+    TEST_ASSERT_DELTA( cut.m_Area, 4.0, 1e-12 );
+    TEST_ASSERT_DELTA( cut.m_MeshAreaVec[0], 4.0, 1e-12 );
+    TEST_ASSERT_DELTA( cut.m_MeshAreaVec[1], 0.0, 1e-12 );
+    CompareVec3ds( cut.m_AreaCenter, vec3d( 0.5, 1.0, 1.0 ), "One box center" );
+
+    //==== Overlap Goes To The Higher Priority Box ====//
+    slicer.Slice( 1.5, cut, true );
+    TEST_ASSERT_DELTA( cut.m_Area, 9.0, 1e-12 );
+    TEST_ASSERT_DELTA( cut.m_MeshAreaVec[0], 3.0, 1e-12 );
+    TEST_ASSERT_DELTA( cut.m_MeshAreaVec[1], 6.0, 1e-12 );
+    CompareVec3ds( cut.m_AreaCenter, vec3d( 1.5, 17.5 / 9.0, 14.5 / 9.0 ), "Union center" );
+
+    //==== Tris Cover The Union And Carry The Mesh Owning Their Area ====//
+    TEST_ASSERT( cut.m_TriMeshVec.size() * 3 == cut.m_TriPntVec.size() );
+    double tri_area = 0.0;
+    vector< double > own_area_vec( mesh_vec.size(), 0.0 );
+    for ( int i = 0 ; i < ( int )cut.m_TriPntVec.size() ; i += 3 )
+    {
+        double a = 0.5 * cross( cut.m_TriPntVec[i + 1] - cut.m_TriPntVec[i], cut.m_TriPntVec[i + 2] - cut.m_TriPntVec[i] ).mag();
+        tri_area += a;
+        own_area_vec[ cut.m_TriMeshVec[ i / 3 ] ] += a;
+    }
+    TEST_ASSERT_DELTA( tri_area, 9.0, 1e-12 );
+    TEST_ASSERT_DELTA( own_area_vec[0], 3.0, 1e-12 );
+    TEST_ASSERT_DELTA( own_area_vec[1], 6.0, 1e-12 );
+
+    //==== Equal Priority Goes To The First Box ====//
+    mesh_vec[1]->m_MassPrior = 0;
+    slicer.Build( mesh_vec, vec3d( 1, 0, 0 ) );
+    slicer.Slice( 1.5, cut, false );
+    TEST_ASSERT_DELTA( cut.m_MeshAreaVec[0], 4.0, 1e-12 );
+    TEST_ASSERT_DELTA( cut.m_MeshAreaVec[1], 5.0, 1e-12 );
+    TEST_ASSERT( cut.m_TriPntVec.empty() );
+    TEST_ASSERT( cut.m_TriMeshVec.empty() );
+
+    //==== Past Both Boxes ====//
+    slicer.Slice( 3.5, cut, true );
+    TEST_ASSERT_DELTA( cut.m_Area, 0.0, 1e-12 );
+
+    for ( int i = 0 ; i < ( int )mesh_vec.size() ; i++ )
+    {
+        delete mesh_vec[i];
+    }
+}
+
+//==== Closed UV Sphere Mesh ====//
+static TMesh* MakeSphereMesh( const vec3d & cen, double rad, int nu, int nv )
+{
+    TMesh* tm = new TMesh();
+
+    vector< vec3d > pnt_vec;
+    for ( int i = 0 ; i <= nu ; i++ )
+    {
+        double phi = M_PI * i / nu;
+        for ( int j = 0 ; j < nv ; j++ )
+        {
+            double theta = 2.0 * M_PI * j / nv;
+            pnt_vec.push_back( cen + vec3d( cos( phi ), sin( phi ) * cos( theta ), sin( phi ) * sin( theta ) ) * rad );
+        }
+    }
+
+    for ( int i = 0 ; i < nu ; i++ )
+    {
+        for ( int j = 0 ; j < nv ; j++ )
+        {
+            int jn = ( j + 1 ) % nv;
+            const vec3d & p00 = pnt_vec[ i * nv + j ];
+            const vec3d & p01 = pnt_vec[ i * nv + jn ];
+            const vec3d & p10 = pnt_vec[ ( i + 1 ) * nv + j ];
+            const vec3d & p11 = pnt_vec[ ( i + 1 ) * nv + jn ];
+            if ( i > 0 )
+            {
+                tm->AddTri( p00, p10, p01, vec3d() );
+            }
+            if ( i < nu - 1 )
+            {
+                tm->AddTri( p01, p10, p11, vec3d() );
+            }
+        }
+    }
+    return tm;
+}
+
+//==== Same Tri Lists With No Tree - Every Query Checks Every Tri ====//
+static void LoadFlatBox( TMesh* tm, TBndBox & box )
+{
+    box.Reset();
+    for ( int i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+    {
+        box.AddTri( tm->m_TVec[i] );
+    }
+}
+
+static bool SameParms( vector< double > a, vector< double > b )
+{
+    std::sort( a.begin(), a.end() );
+    std::sort( b.begin(), b.end() );
+    if ( a.size() != b.size() )
+    {
+        return false;
+    }
+    for ( int i = 0 ; i < ( int )a.size() ; i++ )
+    {
+        if ( std::abs( a[i] - b[i] ) > 1e-6 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void GeomCoreTestSuite::BvhQueryTest()
+{
+    TMesh* mesh_a = MakeSphereMesh( vec3d( 0, 0, 0 ), 1.0, 24, 32 );
+    TMesh* mesh_b = MakeSphereMesh( vec3d( 1.2, 0.3, 0.1 ), 0.8, 20, 28 );
+    TMesh* mesh_c = MakeSphereMesh( vec3d( 5.0, 0.0, 0.0 ), 0.5, 8, 8 );
+    mesh_a->LoadBndBox();
+    mesh_b->LoadBndBox();
+    mesh_c->LoadBndBox();
+    TEST_ASSERT( mesh_a->m_TBox.m_BvhVec.size() > 1 );
+
+    TBndBox flat_a, flat_b;
+    LoadFlatBox( mesh_a, flat_a );
+    LoadFlatBox( mesh_b, flat_b );
+
+    //==== Tri Pair Intersections ====//
+    vector< TISect > bvh_isect_vec, flat_isect_vec;
+    mesh_a->m_TBox.FindIntersections( &mesh_b->m_TBox, bvh_isect_vec );
+    flat_a.FindIntersections( &flat_b, flat_isect_vec );
+
+    vector< pair< TTri*, TTri* > > bvh_pair_vec, flat_pair_vec;
+    for ( int i = 0 ; i < ( int )bvh_isect_vec.size() ; i++ )
+    {
+        bvh_pair_vec.push_back( make_pair( bvh_isect_vec[i].m_Tri0, bvh_isect_vec[i].m_Tri1 ) );
+    }
+    for ( int i = 0 ; i < ( int )flat_isect_vec.size() ; i++ )
+    {
+        flat_pair_vec.push_back( make_pair( flat_isect_vec[i].m_Tri0, flat_isect_vec[i].m_Tri1 ) );
+    }
+    std::sort( bvh_pair_vec.begin(), bvh_pair_vec.end() );
+    std::sort( flat_pair_vec.begin(), flat_pair_vec.end() );
+    TEST_ASSERT( !bvh_pair_vec.empty() );
+    TEST_ASSERT( bvh_pair_vec == flat_pair_vec );
+
+    TEST_ASSERT( mesh_a->m_TBox.CheckIntersect( &mesh_b->m_TBox ) );
+    TEST_ASSERT( !mesh_a->m_TBox.CheckIntersect( &mesh_c->m_TBox ) );
+
+    //==== Ray Casts From Inside And Outside ====//
+    srand( 1 );
+    for ( int i = 0 ; i < 200 ; i++ )
+    {
+        vec3d orig( 4.0 * rand() / RAND_MAX - 2.0, 4.0 * rand() / RAND_MAX - 2.0, 4.0 * rand() / RAND_MAX - 2.0 );
+        vec3d dir( 2.0 * rand() / RAND_MAX - 1.0, 2.0 * rand() / RAND_MAX - 1.0, 2.0 * rand() / RAND_MAX - 1.0 );
+
+        vector< double > bvh_parm_vec, flat_parm_vec;
+        mesh_a->m_TBox.RayCast( orig, dir, bvh_parm_vec );
+        flat_a.RayCast( orig, dir, flat_parm_vec );
+        TEST_ASSERT( SameParms( bvh_parm_vec, flat_parm_vec ) );
+
+        bvh_parm_vec.clear();
+        flat_parm_vec.clear();
+        mesh_a->m_TBox.NumCrossXRay( orig, bvh_parm_vec );
+        flat_a.NumCrossXRay( orig, flat_parm_vec );
+        TEST_ASSERT( SameParms( bvh_parm_vec, flat_parm_vec ) );
+    }
+
+    //==== Segments - Every Crossing, Even With Both Ends Outside The Mesh Box ====//
+    for ( int i = 0 ; i < 200 ; i++ )
+    {
+        vec3d p0( 6.0 * rand() / RAND_MAX - 3.0, 6.0 * rand() / RAND_MAX - 3.0, 6.0 * rand() / RAND_MAX - 3.0 );
+        vec3d p1( 6.0 * rand() / RAND_MAX - 3.0, 6.0 * rand() / RAND_MAX - 3.0, 6.0 * rand() / RAND_MAX - 3.0 );
+
+        vector< vec3d > ipnt_vec;
+        mesh_a->m_TBox.SegIntersect( p0, p1, ipnt_vec );
+
+        vector< double > bvh_parm_vec, flat_parm_vec;
+        for ( int j = 0 ; j < ( int )ipnt_vec.size() ; j++ )
+        {
+            bvh_parm_vec.push_back( dist( p0, ipnt_vec[j] ) );
+        }
+
+        vec3d p10 = p1 - p0;
+        for ( int t = 0 ; t < ( int )mesh_a->m_TVec.size() ; t++ )
+        {
+            TTri* tri = mesh_a->m_TVec[t];
+            vec3d n0pnt  = tri->m_N0->m_Pnt;
+            vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
+            vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
+            double tparm, uparm, vparm;
+            if ( tri_seg_intersect( n0pnt, n10pnt, n20pnt, p0, p10, uparm, vparm, tparm ) )
+            {
+                flat_parm_vec.push_back( dist( p0, p0 + p10 * tparm ) );
+            }
+        }
+        TEST_ASSERT( SameParms( bvh_parm_vec, flat_parm_vec ) );
+    }
+
+    delete mesh_a;
+    delete mesh_b;
+    delete mesh_c;
+}
+
+void GeomCoreTestSuite::MassPropSumTest()
+{
+    //==== Tetras Far From The Origin, Summed Both Ways ====//
+    vec3d off( 1000.0, 50.0, 20.0 );
+    vector< TetraMassProp > tet_vec;
+    MassPropSum sum_a( off );
+    MassPropSum sum_b( off );
+    for ( int i = 0 ; i < 20 ; i++ )
+    {
+        vec3d p0 = off + vec3d( i, 0, 0 );
+        vec3d p1 = off + vec3d( i + 1.0, 0.1 * i, 0 );
+        vec3d p2 = off + vec3d( i, 1.0, 0.2 );
+        vec3d p3 = off + vec3d( i + 0.5, 0.3, 1.0 + 0.05 * i );
+        double den = 1.0 + 0.1 * i;
+
+        tet_vec.push_back( TetraMassProp( "", den, p0, p1, p2, p3 ) );
+        ( i % 2 ? sum_a : sum_b ).AddTetra( den, p0, p1, p2, p3 );
+    }
+
+    MassPropSum sum( off );
+    sum.Add( sum_a );
+    sum.Add( sum_b );
+
+    double mass = 0.0;
+    vec3d cg;
+    for ( int i = 0 ; i < ( int )tet_vec.size() ; i++ )
+    {
+        mass += tet_vec[i].m_Mass;
+        cg = cg + tet_vec[i].m_CG * tet_vec[i].m_Mass;
+    }
+    cg = cg * ( 1.0 / mass );
+
+    double ixx = 0.0;
+    double ixy = 0.0;
+    for ( int i = 0 ; i < ( int )tet_vec.size() ; i++ )
+    {
+        const TetraMassProp & tet = tet_vec[i];
+        ixx += tet.m_Ixx + tet.m_Mass * ( ( cg.y() - tet.m_CG.y() ) * ( cg.y() - tet.m_CG.y() ) + ( cg.z() - tet.m_CG.z() ) * ( cg.z() - tet.m_CG.z() ) );
+        ixy += tet.m_Ixy + tet.m_Mass * ( ( cg.x() - tet.m_CG.x() ) * ( cg.y() - tet.m_CG.y() ) );
+    }
+
+    double sum_ixx, sum_iyy, sum_izz, sum_ixy, sum_ixz, sum_iyz;
+    sum.GetInertia( sum_ixx, sum_iyy, sum_izz, sum_ixy, sum_ixz, sum_iyz );
+
+    TEST_ASSERT_DELTA( sum.GetMass(), mass, 1e-9 * mass );
+    CompareVec3ds( sum.GetCG(), cg, "MassPropSum CG" );
+    TEST_ASSERT_DELTA( sum_ixx, ixx, 1e-9 * std::abs( ixx ) );
+    TEST_ASSERT_DELTA( sum_ixy, ixy, 1e-9 * std::abs( ixy ) );
+
+    //==== Point Mass Adds No Volume ====//
+    double vol = sum.GetVol();
+    sum.AddPointMass( 5.0, off );
+    TEST_ASSERT_DELTA( sum.GetVol(), vol, 1e-12 );
+    TEST_ASSERT_DELTA( sum.GetMass(), mass + 5.0, 1e-9 * mass );
+}
+
 void GeomCoreTestSuite::CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b )
 {
     MeshGeom* mesh_1 = ( MeshGeom* )veh.FindGeom( mesh_a );
@@ -280,3 +715,72 @@ void GeomCoreTestSuite::CompareVec3ds( const vec3d & v1, const vec3d & v2, const
     sprintf( str, "v1[2]: %10.16g v%10.16g %s", v1[2], v2[2], msg );
     TEST_ASSERT_MSG( std::abs( v1[2] - v2[2] ) < 1e-5, str );
 }
+
+static bool SameBits( double a, double b )
+{
+    return memcmp( &a, &b, sizeof( double ) ) == 0;
+}
+
+void GeomCoreTestSuite::BinaryMeshXmlTest()
+{
+    xmlNodePtr root = xmlNewNode( NULL, ( const xmlChar * )"Vsp_Geometry" );
+
+    //==== Odd Byte Counts Exercise Base64 Padding ====//
+    vector< int > int_vec;
+    int_vec.push_back( -7 );
+    int_vec.push_back( 0 );
+    int_vec.push_back( 2147483647 );
+    XmlUtil::AddBinaryIntNode( root, "Int_Vec_Test", int_vec );
+
+    vector< double > dbl_vec;
+    dbl_vec.push_back( 1.0 / 3.0 );
+    dbl_vec.push_back( -1e-300 );
+    dbl_vec.push_back( 6.02214076e23 );
+    XmlUtil::AddBinaryDoubleNode( root, "Dbl_Vec_Test", dbl_vec );
+
+    vector< int > int_ret_vec;
+    TEST_ASSERT( XmlUtil::ExtractBinaryIntNode( root, "Int_Vec_Test", int_ret_vec ) );
+    TEST_ASSERT( int_ret_vec == int_vec );
+
+    vector< double > dbl_ret_vec;
+    TEST_ASSERT( XmlUtil::ExtractBinaryDoubleNode( root, "Dbl_Vec_Test", dbl_ret_vec ) );
+    TEST_ASSERT( dbl_ret_vec == dbl_vec );
+
+    TEST_ASSERT( !XmlUtil::ExtractBinaryDoubleNode( root, "Missing_Test", dbl_ret_vec ) );
+
+    //==== Indexed Mesh Shares Nodes And Keeps Points And Normals Exact ====//
+    TMesh* tm = MakeBoxMesh( vec3d( 0.1, 1.0 / 3.0, -2.0 ), vec3d( 1.7, 2.0, 1e-9 ), 0, false );
+    for ( int i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+    {
+        tm->m_TVec[i]->m_Norm = vec3d( i, 0.5, -1.0 / ( i + 1 ) );
+    }
+
+    //==== -0.0 And 0.0 Compare Equal But Must Stay Separate Nodes ====//
+    tm->AddTri( vec3d( -0.0, 0.0, 0.0 ), vec3d( 1.0, 0.0, 0.0 ), vec3d( 0.0, 1.0, 0.0 ), vec3d( 0.0, 0.0, -0.0 ) );
+    tm->AddTri( vec3d( 0.0, 0.0, 0.0 ), vec3d( 0.0, 1.0, 0.0 ), vec3d( 1.0, 0.0, 0.0 ), vec3d( 0.0, 0.0, 1.0 ) );
+
+    xmlNodePtr mesh_node = xmlNewChild( root, NULL, ( const xmlChar * )"MeshGeom", NULL );
+    xmlNodePtr tmesh_node = tm->EncodeXml( mesh_node, true );
+
+    TMesh* dm = new TMesh();
+    dm->DecodeXml( tmesh_node );
+
+    TEST_ASSERT( dm->m_NVec.size() == 12 );
+    TEST_ASSERT( dm->m_TVec.size() == tm->m_TVec.size() );
+    for ( int i = 0 ; i < ( int )dm->m_TVec.size() ; i++ )
+    {
+        TTri* a = tm->m_TVec[i];
+        TTri* b = dm->m_TVec[i];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            TEST_ASSERT( SameBits( a->m_N0->m_Pnt[k], b->m_N0->m_Pnt[k] ) );
+            TEST_ASSERT( SameBits( a->m_N1->m_Pnt[k], b->m_N1->m_Pnt[k] ) );
+            TEST_ASSERT( SameBits( a->m_N2->m_Pnt[k], b->m_N2->m_Pnt[k] ) );
+            TEST_ASSERT( SameBits( a->m_Norm[k], b->m_Norm[k] ) );
+        }
+    }
+
+    delete tm;
+    delete dm;
+    xmlFreeNode( root );
+}
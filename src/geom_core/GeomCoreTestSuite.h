@@ -24,18 +24,30 @@ public:
         TEST_ADD( GeomCoreTestSuite::GeomXFormTest )
         TEST_ADD( GeomCoreTestSuite::ParmTest )
         TEST_ADD( GeomCoreTestSuite::VehicleTest )
+        TEST_ADD( GeomCoreTestSuite::DirtyUpdateTest )
+        TEST_ADD( GeomCoreTestSuite::ConformalUpdateTest )
         TEST_ADD( GeomCoreTestSuite::PodTest )
         TEST_ADD( GeomCoreTestSuite::XmlTest )
         TEST_ADD( GeomCoreTestSuite::MeshIOTest )
+        TEST_ADD( GeomCoreTestSuite::MeshSliceTest )
+        TEST_ADD( GeomCoreTestSuite::BvhQueryTest )
+        TEST_ADD( GeomCoreTestSuite::MassPropSumTest )
+        TEST_ADD( GeomCoreTestSuite::BinaryMeshXmlTest )
     }
 
 private:
     void GeomXFormTest();
     void ParmTest();
     void VehicleTest();
+    void DirtyUpdateTest();
+    void ConformalUpdateTest();
     void PodTest();
     void XmlTest();
     void MeshIOTest();
+    void MeshSliceTest();
+    void BvhQueryTest();
+    void MassPropSumTest();
+    void BinaryMeshXmlTest();
     void CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b );
     void CompareVec3ds( const vec3d & v1, const vec3d & v2, const char * msg = NULL );
 
@@ -332,6 +332,14 @@ double PointSimpleSource::GetTargetLen( double base_len, vec3d &  pos )
     return ( m_Len + fract * ( base_len - m_Len  ) );
 }
 
+BndBox PointSimpleSource::GetInfluenceBox()
+{
+    BndBox box;
+    box.Update( m_Loc + vec3d( m_Rad, m_Rad, m_Rad ) );
+    box.Update( m_Loc - vec3d( m_Rad, m_Rad, m_Rad ) );
+    return box;
+}
+
 void PointSimpleSource::Update( Geom* geomPtr )
 {
     m_Loc = geomPtr->GetUWPt( m_SurfIndx, m_ULoc, m_WLoc );
@@ -894,9 +902,25 @@ double GridDensity::GetTargetLen( vec3d& pos, bool farFlag )
     }
     base_len = target_len;
 
-    for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+    if ( m_SourceTree.IsEmpty() )
     {
-        double len = m_Sources[i]->GetTargetLen( base_len, pos );
+        for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+        {
+            double len = m_Sources[i]->GetTargetLen( base_len, pos );
+            if ( len < target_len )
+            {
+                target_len = len;
+            }
+        }
+        return target_len;
+    }
+
+    //==== Only Sources Whose Influence Box Holds pos Can Lower The Length ====//
+    vector< int > src_ind;
+    m_SourceTree.FindContaining( pos, src_ind );
+    for ( int i = 0 ; i < ( int )src_ind.size() ; i++ )
+    {
+        double len = m_Sources[ src_ind[i] ]->GetTargetLen( base_len, pos );
         if ( len < target_len )
         {
             target_len = len;
@@ -905,6 +929,58 @@ double GridDensity::GetTargetLen( vec3d& pos, bool farFlag )
     return target_len;
 }
 
+void GridDensity::GetTargetLen( const vector< double > & x, const vector< double > & y, const vector< double > & z,
+                                vector< double > & len, bool farFlag )
+{
+    double base_len;
+    if( !farFlag )
+    {
+        base_len = m_BaseLen();
+    }
+    else
+    {
+        base_len = m_FarMaxLen();
+    }
+
+    int npnt = ( int )x.size();
+    len.assign( npnt, base_len );
+
+    if ( m_SourceTree.IsEmpty() )
+    {
+        //==== Source Outer Loop - One Source Stays Hot In Cache Across All Points ====//
+        for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+        {
+            for ( int k = 0 ; k < npnt ; k++ )
+            {
+                vec3d pos( x[k], y[k], z[k] );
+                len[k] = min( len[k], m_Sources[i]->GetTargetLen( base_len, pos ) );
+            }
+        }
+        return;
+    }
+
+    vector< int > src_ind;
+    for ( int k = 0 ; k < npnt ; k++ )
+    {
+        vec3d pos( x[k], y[k], z[k] );
+        m_SourceTree.FindContaining( pos, src_ind );
+        for ( int i = 0 ; i < ( int )src_ind.size() ; i++ )
+        {
+            len[k] = min( len[k], m_Sources[ src_ind[i] ]->GetTargetLen( base_len, pos ) );
+        }
+    }
+}
+
+void GridDensity::BuildSourceTree()
+{
+    vector< BndBox > box_vec( m_Sources.size() );
+    for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+    {
+        box_vec[i] = m_Sources[i]->GetInfluenceBox();
+    }
+    m_SourceTree.Build( box_vec );
+}
+
 void GridDensity::ScaleAllSources( double scale )
 {
     for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
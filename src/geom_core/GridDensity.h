@@ -19,6 +19,7 @@
 #include "Vec2d.h"
 #include "Vec3d.h"
 #include "BndBox.h"
+#include "BndBoxTree.h"
 #include "XmlUtil.h"
 #include "Parm.h"
 #include "ParmContainer.h"
@@ -157,6 +158,12 @@ public:
 
     virtual double GetTargetLen( double base_len, vec3d &  pos ) = 0;
 
+    //==== Region Outside Which GetTargetLen Returns base_len ====//
+    virtual BndBox GetInfluenceBox()
+    {
+        return m_Box;
+    }
+
     virtual void Draw()                                             {}
 
     virtual void Update( Geom* geomPtr )                            {}
@@ -190,6 +197,7 @@ public:
     virtual ~PointSimpleSource()      {}
 
     double GetTargetLen( double base_len, vec3d &  pos );
+    virtual BndBox GetInfluenceBox();
 
     virtual void Update( Geom* geomPtr );
 
@@ -352,13 +360,22 @@ public:
 
     double GetTargetLen( vec3d& pos, bool farFlag = false );
 
+    //==== Target Length At Many Points, Given As Separate Coordinate Arrays ====//
+    void GetTargetLen( const vector< double > & x, const vector< double > & y, const vector< double > & z,
+                       vector< double > & len, bool farFlag = false );
+
+    //==== Index Source Influence Boxes - Call Once Sources Are Placed ====//
+    void BuildSourceTree();
+
     void ClearSources()
     {
         m_Sources.clear();    //Deleted in Geom
+        m_SourceTree.Clear();
     }
     void AddSource( BaseSimpleSource* s )
     {
         m_Sources.push_back( s );
+        m_SourceTree.Clear();
     }
     int  GetNumSources()
     {
@@ -386,6 +403,10 @@ protected:
     string m_GroupName;
     vector< BaseSimpleSource* > m_Sources;                // Sources + Ref Sources in 3D Space
 
+    // Influence boxes of m_Sources.  Empty until BuildSourceTree, and cleared
+    // whenever the source list changes, in which case every source is checked.
+    BndBoxTree m_SourceTree;
+
 };
 
 class CfdGridDensity : public GridDensity
@@ -28,6 +28,10 @@ public:
     virtual void UpdateMotionFlagsLimits();
 
     virtual void UpdateDrawObj();
+    virtual bool UsesPreTess()
+    {
+        return false;
+    }
     virtual void LoadDrawObjs(vector< DrawObj* > & draw_obj_vec);
 
     virtual Matrix4d GetJointMatrix();
@@ -23,6 +23,8 @@ LinkMgrSingleton::LinkMgrSingleton()
     m_UserParms.SetNumPredefined( m_NumPredefinedUserParms );
     m_UserParms.Renew(m_NumPredefinedUserParms);
 
+    m_BatchDepth = 0;
+    m_BatchCommitFlag = false;
 }
 
 void LinkMgrSingleton::Init()
@@ -54,6 +56,11 @@ void LinkMgrSingleton::Wype()
 
     m_UpdatedParmVec = vector< string >();
 
+    m_BatchDepth = 0;
+    m_BatchCommitFlag = false;
+    m_BatchParmVec = vector< string >();
+    m_BatchParmSet.clear();
+
     m_BaseLinkableContainers = vector< string >();
     m_LinkableContainers = vector< string >();
 }
@@ -145,6 +152,7 @@ void LinkMgrSingleton::CheckLinks()
 
     for ( int i = 0 ; i < ( int )del_indices.size() ; i++ )
     {
+        UnIndexLink( m_LinkVec[ del_indices[i] ] );
         m_LinkVec.erase( m_LinkVec.begin() + del_indices[i] );
     }
 
@@ -178,10 +186,15 @@ bool LinkMgrSingleton::AddCurrLink()
 //==== Check For Duplicate Link  ====//
 bool LinkMgrSingleton::CheckForDuplicateLink( const string & pA, const string &  pB )
 {
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    unordered_map< string, vector< Link* > >::const_iterator it = m_ParmALinkMap.find( pA );
+    if ( it == m_ParmALinkMap.end() )
     {
-        if ( m_LinkVec[i]->GetParmA() == pA &&
-                m_LinkVec[i]->GetParmB() == pB )
+        return false;
+    }
+
+    for ( int i = 0 ; i < ( int )it->second.size() ; i++ )
+    {
+        if ( it->second[i]->GetParmB() == pB )
         {
             return true;
         }
@@ -207,12 +220,9 @@ bool LinkMgrSingleton::UsedInLink( const string & pid )
 bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB )
 {
     //==== Make Sure Parm Are Not Already Linked ====//
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    if ( CheckForDuplicateLink( pidA, pidB ) )
     {
-        if ( m_LinkVec[i]->GetParmA() == pidA && m_LinkVec[i]->GetParmB() == pidB  )
-        {
-            return false;
-        }
+        return false;
     }
 
     //==== Check If ParmIDs Are Valid ====//
@@ -233,12 +243,38 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB )
     pl->SetScaleFlag( false );
     pl->m_Scale.Set( 1.0 );
 
-    m_LinkVec.push_back( pl );
+    AddLink( pl );
     m_CurrLinkIndex = ( int )m_LinkVec.size() - 1;
 
     return true;
 }
 
+void LinkMgrSingleton::AddLink( Link* link )
+{
+    m_LinkVec.push_back( link );
+    IndexLink( link );
+}
+
+void LinkMgrSingleton::IndexLink( Link* link )
+{
+    m_ParmALinkMap[ link->GetParmA() ].push_back( link );
+}
+
+void LinkMgrSingleton::UnIndexLink( Link* link )
+{
+    unordered_map< string, vector< Link* > >::iterator it = m_ParmALinkMap.find( link->GetParmA() );
+    if ( it == m_ParmALinkMap.end() )
+    {
+        return;
+    }
+
+    vector_remove_val( it->second, link );
+    if ( it->second.empty() )
+    {
+        m_ParmALinkMap.erase( it );
+    }
+}
+
 //==== Delete Curr Link ====//
 void LinkMgrSingleton::DelCurrLink()
 {
@@ -249,6 +285,7 @@ void LinkMgrSingleton::DelCurrLink()
 
     Link* pl = m_LinkVec[m_CurrLinkIndex];
 
+    UnIndexLink( pl );
     m_LinkVec.erase( m_LinkVec.begin() +  m_CurrLinkIndex );
 
     delete pl;
@@ -265,6 +302,7 @@ void LinkMgrSingleton::DelAllLinks()
     }
 
     m_LinkVec.clear();
+    m_ParmALinkMap.clear();
     m_CurrLinkIndex = -1;
 }
 //==== Link All Parms In A Group ====//
@@ -375,17 +413,25 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
     if ( !parm_ptr )
         return;
 
+    //==== Batched - Links Are Applied When The Batch Ends ====//
+    if ( m_BatchDepth > 0 )
+    {
+        if ( m_BatchParmSet.insert( pid ).second )
+        {
+            m_BatchParmVec.push_back( pid );
+        }
+        return;
+    }
+
     //==== Check For Advanced Links ====//
     bool adv_link_flag = AdvLinkMgr.IsInputParm( pid );
 
     //==== Look for Reg Links  ====//
     vector < Link* > parm_link_vec;
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    unordered_map< string, vector< Link* > >::const_iterator it = m_ParmALinkMap.find( pid );
+    if ( it != m_ParmALinkMap.end() )
     {
-        if ( m_LinkVec[i]->GetParmA() == pid )
-        {
-            parm_link_vec.push_back( m_LinkVec[i] );
-        }
+        parm_link_vec = it->second;
     }
 
     //==== Check Links ====//
@@ -447,15 +493,7 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
     //==== Clean Up ====/
     if ( start_flag )      
     {
-        for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
-        {
-            Parm* p = ParmMgr.FindParm( m_UpdatedParmVec[i] );
-            if ( p )
-            {
-                p->SetLinkUpdateFlag( false );
-            }
-        }
-        m_UpdatedParmVec.clear();
+        ClearLinkUpdateFlags();
 
         Vehicle* veh = VehicleMgr.GetVehicle();
         if ( veh )
@@ -467,6 +505,55 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
 
 
 
+void LinkMgrSingleton::ClearLinkUpdateFlags()
+{
+    for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( m_UpdatedParmVec[i] );
+        if ( p )
+        {
+            p->SetLinkUpdateFlag( false );
+        }
+    }
+    m_UpdatedParmVec.clear();
+}
+
+//==== Start Collecting Parm Sets - Batches May Nest ====//
+void LinkMgrSingleton::BeginBatch()
+{
+    m_BatchDepth++;
+}
+
+//==== Apply Links For Every Parm Set During The Batch ====//
+bool LinkMgrSingleton::EndBatch()
+{
+    if ( m_BatchDepth == 0 )
+    {
+        return false;
+    }
+
+    m_BatchDepth--;
+    if ( m_BatchDepth > 0 )
+    {
+        return false;
+    }
+
+    vector< string > pid_vec;
+    pid_vec.swap( m_BatchParmVec );
+    m_BatchParmSet.clear();
+
+    //==== Linked Parms Only Flag Their Containers, The Caller Updates Once ====//
+    m_BatchCommitFlag = true;
+    for ( int i = 0 ; i < ( int )pid_vec.size() ; i++ )
+    {
+        ParmChanged( pid_vec[i], false );
+        ClearLinkUpdateFlags();
+    }
+    m_BatchCommitFlag = false;
+
+    return true;
+}
+
 void LinkMgrSingleton::SetParm( bool flagA, string parm_id )
 {
     if ( !ParmMgr.FindParm( parm_id ) )
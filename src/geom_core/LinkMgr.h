@@ -13,9 +13,13 @@
 
 #include "Link.h"
 #include <deque>
+#include <unordered_map>
+#include <unordered_set>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
+using std::unordered_set;
 
 
 //==== Parm Link Manager ====//
@@ -44,9 +48,14 @@ public:
     virtual bool UsedInLink( const string & pid );
 
     virtual bool AddLink( const string& pA, const string& pB );         // Link Two Parms
-    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); }
+    virtual void AddLink( Link* link );
     virtual void ParmChanged( const string& pid, bool start_flag );     // A Parm Has Changed Check Links
 
+    //==== Batched Parm Sets - Links Are Applied Once, When The Batch Ends ====//
+    virtual void BeginBatch();
+    virtual bool EndBatch();                    // True If The Outermost Batch Was Committed
+    virtual bool IsBatchActive()                            { return m_BatchDepth > 0 || m_BatchCommitFlag; }
+
     virtual void SetCurrLinkIndex( int i )                  { m_CurrLinkIndex = i; }
     virtual int  GetCurrLinkIndex()                         { return m_CurrLinkIndex; }
     virtual Link* GetCurrLink();
@@ -105,7 +114,18 @@ private:
 
     deque< Link* > m_LinkVec;
 
+    //==== Links Keyed By ParmA ID, Each List In m_LinkVec Order ====//
+    unordered_map< string, vector< Link* > > m_ParmALinkMap;
+    void IndexLink( Link* link );
+    void UnIndexLink( Link* link );
+
     vector< string > m_UpdatedParmVec;      // Keep Track Of Linked Parm To Prevent Circular Links
+    void ClearLinkUpdateFlags();
+
+    int m_BatchDepth;
+    bool m_BatchCommitFlag;                 // Applying Links Of A Batch - Linked Parms Update Late
+    vector< string > m_BatchParmVec;        // Parms Set During The Batch, In First Set Order
+    unordered_set< string > m_BatchParmSet;
 
     vector< string > m_BaseLinkableContainers;              // Base Registered Parm Containers
     vector< string > m_LinkableContainers;                  // All valid Linkable Container
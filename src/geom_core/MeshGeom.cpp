@@ -22,6 +22,9 @@
 
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "ParallelUtil.h"
+#include "MeshSlicer.h"
+#include "MeshFileUtil.h"
 
 #include "SubSurfaceMgr.h"
 
@@ -105,9 +108,11 @@ xmlNodePtr MeshGeom::EncodeXml( xmlNodePtr & node )
     Geom::EncodeXml( node );
     xmlNodePtr mesh_node = xmlNewChild( node, NULL, BAD_CAST "MeshGeom", NULL );
     XmlUtil::AddIntNode( mesh_node, "Num_Meshes", ( int )m_TMeshVec.size() );
+
+    bool binary_flag = m_Vehicle && m_Vehicle->m_BinaryMeshFlag();
     for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        m_TMeshVec[i]->EncodeXml( mesh_node );
+        m_TMeshVec[i]->EncodeXml( mesh_node, binary_flag );
     }
 
     return mesh_node;
@@ -251,175 +256,59 @@ void MeshGeom::AddTri( TMesh* tMesh, vec3d & p0, vec3d & p1, vec3d & p2 )
 
 
 
-int MeshGeom::ReadSTL( const char* file_name )
+//==== TMesh With One Node Per Point, Tri Normals From The Data Or The Tri Points ====//
+static TMesh* BuildIndexedTMesh( const IndexedMeshData & data )
 {
-    FILE* file_id = fopen( file_name, "r" );
-
-    char str[256];
-    float nx, ny, nz;
-    float v0[3];
-    float v1[3];
-    float v2[3];
-    TTri*  tPtr;
-    TMesh*  tMesh = new TMesh();
+    TMesh* tMesh = new TMesh();
 
-    if ( file_id )
+    tMesh->m_NVec.resize( data.m_PntVec.size() );
+    for ( int i = 0 ; i < ( int )data.m_PntVec.size() ; i++ )
     {
-        //==== Cheesy ASCII/Binary Test ====//
-        int binaryFlag = 0;
-        while ( fgets( str, 255, file_id ) )
-        {
-            for ( int i = 0 ; i < ( int )strlen( str ) ; i++ )
-            {
-                if ( ( unsigned char )str[i] > 127 )
-                {
-                    binaryFlag = 1;
-                    break;
-                }
-            }
-        }
-
-        rewind( file_id );
-
-        if ( !binaryFlag )
-        {
-            fgets( str, 255, file_id );
-
-            int stopFlag = 0;
-
-            while ( !stopFlag )
-            {
-                if ( EOF == fscanf( file_id, "%*s %*s %f %f %f\n", &nx, &ny, &nz ) )
-                {
-                    break;
-                }
-
-                if ( EOF == fscanf( file_id, "%*s %*s" ) )
-                {
-                    break;
-                }
+        tMesh->m_NVec[i] = new TNode();
+        tMesh->m_NVec[i]->m_Pnt = data.m_PntVec[i];
+    }
 
-                if ( EOF == fscanf( file_id, "%*s %f %f %f\n", &v0[0], &v0[1], &v0[2] ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s %f %f %f\n", &v1[0], &v1[1], &v1[2] ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s %f %f %f\n", &v2[0], &v2[1], &v2[2] ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s" ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s" ) )
-                {
-                    break;
-                }
+    int ntri = data.GetNumTris();
+    bool norm_flag = ( ( int )data.m_NormVec.size() == ntri );
 
-                //==== Add Valid Facet ====//
-                tPtr = new TTri();
-                tPtr->m_InteriorFlag = 0;
-                tPtr->m_Norm = vec3d( nx, ny, nz );
-                tMesh->m_TVec.push_back( tPtr );
-
-                //==== Put Nodes Into Tri ====//
-                tPtr->m_N0 = new TNode();
-                tPtr->m_N1 = new TNode();
-                tPtr->m_N2 = new TNode();
-                tPtr->m_N0->m_Pnt = vec3d( v0[0], v0[1], v0[2] );
-                tPtr->m_N1->m_Pnt = vec3d( v1[0], v1[1], v1[2] );
-                tPtr->m_N2->m_Pnt = vec3d( v2[0], v2[1], v2[2] );
-                tMesh->m_NVec.push_back( tPtr->m_N0 );
-                tMesh->m_NVec.push_back( tPtr->m_N1 );
-                tMesh->m_NVec.push_back( tPtr->m_N2 );
-
-                fpos_t pos;
-                fgetpos( file_id, &pos );
-
-                if ( EOF == fscanf( file_id, "%s %*s\n", str ) )
-                {
-                    break;
-                }
+    tMesh->m_TVec.resize( ntri );
+    for ( int i = 0 ; i < ntri ; i++ )
+    {
+        TTri* tPtr = new TTri();
+        tPtr->m_N0 = tMesh->m_NVec[ data.m_TriVec[ 3 * i ] ];
+        tPtr->m_N1 = tMesh->m_NVec[ data.m_TriVec[ 3 * i + 1 ] ];
+        tPtr->m_N2 = tMesh->m_NVec[ data.m_TriVec[ 3 * i + 2 ] ];
 
-                if ( strcmp( str, "endsolid" ) == 0 )
-                {
-                    fgets( str, 255, file_id );
-                    if ( feof( file_id ) )
-                    {
-                        break;
-                    }
-                }
-                else
-                {
-                    fsetpos( file_id, &pos );
-                }
-            }
+        if ( norm_flag )
+        {
+            tPtr->m_Norm = data.m_NormVec[i];
         }
         else
         {
-            fclose( file_id );
-            file_id = fopen( file_name, "rb" );         // Reopen as Binary
-
-            //==== Header ====//
-            fread( str, sizeof( char ), 80, file_id );
-
-            int numFacet = ReadBinInt( file_id );
-
-            for ( int i = 0 ; i < numFacet ; i++ )
-            {
-                nx = ReadBinFloat( file_id );
-                ny = ReadBinFloat( file_id );
-                nz = ReadBinFloat( file_id );
-
-                v0[0] = ReadBinFloat( file_id );
-                v0[1] = ReadBinFloat( file_id );
-                v0[2] = ReadBinFloat( file_id );
-                v1[0] = ReadBinFloat( file_id );
-                v1[1] = ReadBinFloat( file_id );
-                v1[2] = ReadBinFloat( file_id );
-                v2[0] = ReadBinFloat( file_id );
-                v2[1] = ReadBinFloat( file_id );
-                v2[2] = ReadBinFloat( file_id );
-
-                //==== Padding ====//
-                fgetc( file_id );
-                fgetc( file_id );
-
-                //==== Add Valid Facet ====//
-                tPtr = new TTri();
-                tPtr->m_InteriorFlag = 0;
-                tPtr->m_Norm = vec3d( nx, ny, nz );
-                tMesh->m_TVec.push_back( tPtr );
-
-                //==== Put Nodes Into Tri ====//
-                tPtr->m_N0 = new TNode();
-                tPtr->m_N1 = new TNode();;
-                tPtr->m_N2 = new TNode();
-                tPtr->m_N0->m_Pnt = vec3d( v0[0], v0[1], v0[2] );
-                tPtr->m_N1->m_Pnt = vec3d( v1[0], v1[1], v1[2] );
-                tPtr->m_N2->m_Pnt = vec3d( v2[0], v2[1], v2[2] );
-
-            }
+            vec3d p10 = tPtr->m_N1->m_Pnt - tPtr->m_N0->m_Pnt;
+            vec3d p20 = tPtr->m_N2->m_Pnt - tPtr->m_N0->m_Pnt;
+            tPtr->m_Norm = cross( p10, p20 );
+            tPtr->m_Norm.normalize();
         }
-        fclose( file_id );
+
+        tMesh->m_TVec[i] = tPtr;
     }
 
+    return tMesh;
+}
 
-    if ( tMesh->m_TVec.size() == 0 )
+int MeshGeom::ReadSTL( const char* file_name )
+{
+    IndexedMeshData data;
+    if ( !MeshFileUtil::ReadSTL( file_name, data ) )
     {
-        delete tMesh;
         return 0;
     }
 
-    m_TMeshVec.push_back( tMesh );
+    m_TMeshVec.push_back( BuildIndexedTMesh( data ) );
     UpdateBBox();
 
     return 1;
-
 }
 
 //==== Write Fuse File ====//
@@ -521,123 +410,41 @@ void MeshGeom::WriteStl( FILE* file_id, int tag )
 
 int MeshGeom::ReadNascart( const char* file_name )
 {
-    int i;
-    FILE* file_id = fopen( file_name, "r" );
-
-    if ( !file_id )
+    IndexedMeshData data;
+    if ( !MeshFileUtil::ReadIndexedTriFile( file_name, 1, data ) )
     {
         return 0;
     }
 
-    TMesh*  tMesh = new TMesh();
-
-    //==== Read Number Tris and Nodes ====//
-    float x, y, z;
-    int n0, n1, n2;
-    float col;
-    int num_tris, num_nodes;
-
-    fscanf( file_id, "%d", &num_nodes );
-    fscanf( file_id, "%d", &num_tris  );
-
-    vec3d p;
-    vector< vec3d > pVec;
-    for ( i = 0 ; i < num_nodes ; i++ )
-    {
-        fscanf( file_id, "%f %f %f", &x, &y, &z );
-        p.set_xyz( x, -z, y );
-        pVec.push_back( p );
-    }
-
-    for ( i = 0 ; i < num_tris ; i++ )
+    //==== Nascart Is Y Up With Tris Wound The Other Way ====//
+    for ( int i = 0 ; i < ( int )data.m_PntVec.size() ; i++ )
     {
-        fscanf( file_id, "%d %d %d %f", &n0, &n2, &n1, &col );
-
-        //==== Compute Normal ====//
-        vec3d p10 = pVec[n1 - 1] - pVec[n0 - 1];
-        vec3d p20 = pVec[n2 - 1] - pVec[n0 - 1];
-        vec3d norm = cross( p10, p20 );
-        norm.normalize();
-
-        //==== Add Valid Facet ====//
-        tMesh->AddTri( pVec[n0 - 1], pVec[n1 - 1], pVec[n2 - 1], norm );
+        vec3d & p = data.m_PntVec[i];
+        p.set_xyz( p.x(), -p.z(), p.y() );
     }
-
-    fclose( file_id );
-
-    if ( tMesh->m_TVec.size() == 0 )
+    for ( int i = 0 ; i < data.GetNumTris() ; i++ )
     {
-        delete tMesh;
-        return 0;
+        std::swap( data.m_TriVec[ 3 * i + 1 ], data.m_TriVec[ 3 * i + 2 ] );
     }
 
-    m_TMeshVec.push_back( tMesh );
-
+    m_TMeshVec.push_back( BuildIndexedTMesh( data ) );
     UpdateBBox();
 
-
     return 1;
-
 }
 
 //==== Read Tri File ====//
 int MeshGeom::ReadTriFile( const char * file_name )
 {
-    int i;
-    FILE* file_id = fopen( file_name, "r" );
-
-    if ( !file_id )
-    {
-        return 0;
-    }
-
-    TMesh*  tMesh = new TMesh();
-
-    //==== Read Number Tris and Nodes ====//
-    float x, y, z;
-    int n0, n1, n2;
-    int num_tris, num_nodes;
-
-    fscanf( file_id, "%d", &num_nodes );
-    fscanf( file_id, "%d", &num_tris  );
-
-    vec3d p;
-    vector< vec3d > pVec;
-    pVec.resize( num_nodes );
-    for ( i = 0 ; i < num_nodes ; i++ )
+    IndexedMeshData data;
+    if ( !MeshFileUtil::ReadIndexedTriFile( file_name, 0, data ) )
     {
-        fscanf( file_id, "%f %f %f", &x, &y, &z );
-        p.set_xyz( x, y, z );
-        pVec[i] = p;
-    }
-
-    for ( i = 0 ; i < num_tris ; i++ )
-    {
-        fscanf( file_id, "%d %d %d", &n0, &n1, &n2 );
-
-        //==== Compute Normal ====//
-        vec3d p10 = pVec[n1 - 1] - pVec[n0 - 1];
-        vec3d p20 = pVec[n2 - 1] - pVec[n0 - 1];
-        vec3d norm = cross( p10, p20 );
-        norm.normalize();
-
-        //==== Add Valid Facet ====//
-        tMesh->AddTri( pVec[n0 - 1], pVec[n1 - 1], pVec[n2 - 1], norm );
-    }
-
-    fclose( file_id );
-
-    if ( tMesh->m_TVec.size() == 0 )
-    {
-        delete tMesh;
         return 0;
     }
 
-    m_TMeshVec.push_back( tMesh );
-
+    m_TMeshVec.push_back( BuildIndexedTMesh( data ) );
     UpdateBBox();
 
-
     return 1;
 }
 
@@ -1602,6 +1409,33 @@ void MeshGeom::TransformMeshVec( vector<TMesh*> & meshVec, Matrix4d & TransMat )
     }
 }
 
+//==== Intersect Every Mesh With Every Other Mesh ====//
+// Each pair is intersected in parallel into its own buffer, then the
+// intersection edges are added in pair order, same as the serial loop.
+void MeshGeom::IntersectMeshPairs()
+{
+    vector< pair< int, int > > pairVec;
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        for ( int j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        {
+            pairVec.push_back( pair< int, int >( i, j ) );
+        }
+    }
+
+    vector< vector< TISect > > isectVecs( pairVec.size() );
+
+    ParallelFor( ( int )pairVec.size(), [&]( int p )
+    {
+        m_TMeshVec[ pairVec[p].first ]->FindIntersections( m_TMeshVec[ pairVec[p].second ], isectVecs[p] );
+    } );
+
+    for ( int p = 0 ; p < ( int )isectVecs.size() ; p++ )
+    {
+        TMesh::AddISectEdges( isectVecs[p] );
+    }
+}
+
 void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
 {
     int i, j;
@@ -1732,13 +1566,7 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
     //update_xformed_bbox();            // Load Xform BBox
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2019,13 +1847,7 @@ void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
     //update_xformed_bbox();          // Load Xform BBox
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2156,6 +1978,51 @@ void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
 }
 
 //==== Call After BndBoxes Have Been Create But Before Intersect ====//
+//==== Hang The Tris Of A Slice Region Under The Slice Plane As Split Tris ====//
+//==== Each Tri Takes The ID Of The Mesh That Owns Its Area ====//
+static void LoadSliceTris( TMesh* tm, const MeshSlice & cut, const vector< TMesh* > & mesh_vec )
+{
+    const vector< vec3d > & tri_pnt_vec = cut.m_TriPntVec;
+
+    if ( tm->m_TVec.empty() )
+    {
+        return;
+    }
+
+    for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+    {
+        tm->m_TVec[t]->m_InteriorFlag = 1;
+    }
+
+    TTri* plane_tri = tm->m_TVec[0];
+    if ( plane_tri->m_NVec.empty() )
+    {
+        plane_tri->m_NVec.push_back( plane_tri->m_N0 );
+        plane_tri->m_NVec.push_back( plane_tri->m_N1 );
+        plane_tri->m_NVec.push_back( plane_tri->m_N2 );
+    }
+
+    for ( int i = 0 ; i < ( int )tri_pnt_vec.size() - 2 ; i += 3 )
+    {
+        TTri* tri = new TTri();
+        tri->m_N0 = new TNode();
+        tri->m_N1 = new TNode();
+        tri->m_N2 = new TNode();
+        tri->m_N0->m_Pnt = tri_pnt_vec[i];
+        tri->m_N1->m_Pnt = tri_pnt_vec[i + 1];
+        tri->m_N2->m_Pnt = tri_pnt_vec[i + 2];
+        tri->m_Norm = plane_tri->m_Norm;
+        tri->m_InteriorFlag = 0;
+        tri->m_ID = mesh_vec[ cut.m_TriMeshVec[ i / 3 ] ]->m_PtrID;
+        tri->SetTMeshPtr( tm );
+
+        plane_tri->m_NVec.push_back( tri->m_N0 );
+        plane_tri->m_NVec.push_back( tri->m_N1 );
+        plane_tri->m_NVec.push_back( tri->m_N2 );
+        plane_tri->m_SplitVec.push_back( tri );
+    }
+}
+
 void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
                           bool autoBounds, double start, double end )
 {
@@ -2335,53 +2202,16 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
         }
     }
 
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
+    //==== Cut All Slice Planes From One Sorted Copy Of The Mesh Tris ====//
+    MeshSlicer slicer;
+    slicer.Build( m_TMeshVec, norm );
 
-        //==== Flip Int/Ext Flags ====//
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
-        {
-            TTri* tri = tm->m_TVec[i];
-            if ( tri->m_SplitVec.size() )
-            {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                {
-                    tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
-                }
-            }
-            else
-            {
-                tri->m_InteriorFlag = !( tri->m_InteriorFlag );
-            }
-        }
-    }
+    vector< MeshSlice > cut_vec( m_SliceVec.size() );
+    ParallelFor( ( int )m_SliceVec.size(), [&]( int is )
+    {
+        double x = xMin + ( ( double )is / ( double )( numSlices - 1 ) ) * ( xMax - xMin );
+        slicer.Slice( x, cut_vec[is], true );
+    } );
 
     TransMat.affineInverse();
 
@@ -2391,7 +2221,9 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
     for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
     {
         double x = xMin + ( ( double )s / ( double )( numSlices - 1 ) ) * ( xMax - xMin );
-        m_SliceVec[s]->ComputeWetArea();
+        LoadSliceTris( m_SliceVec[s], cut_vec[s], m_TMeshVec );
+        m_SliceVec[s]->m_WetArea = cut_vec[s].m_Area;
+        m_SliceVec[s]->m_AreaCenter = cut_vec[s].m_AreaCenter;
         loc_vec.push_back( x );
         area_vec.push_back( m_SliceVec[s]->m_WetArea );
         AreaCenter.push_back( TransMat.xform( m_SliceVec[s]->m_AreaCenter ) );
@@ -2734,13 +2566,7 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
     }
 
     //==== Intersect All Mesh Geoms (before slicing) ====//
-    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( int j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
     for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2754,6 +2580,10 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         WaveDragMgr.m_XNorm[islice] = ( ( double )islice / ( double )( numSlices - 1 ) );
     }
 
+    //==== Plane Normal And A Point On The Plane For Each Slice ====//
+    vector< vec3d > plane_norm_vec;
+    vector< vec3d > plane_pnt_vec;
+
     //==== Build Slice Mesh Object =====//
     for ( int islice = 0 ; islice < numSlices ; islice++ )
     {
@@ -2794,6 +2624,9 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
             vec3d gpnorm = cross( gp[3]-gp[2], gp[1]-gp[2] );
             gpnorm.normalize();
 
+            plane_norm_vec.push_back( gpnorm );
+            plane_pnt_vec.push_back( vec3d( xcenter, center.y(), center.z() ) );
+
             // Build triangles
             tm->AddTri( gp[2], gp[3], gp[0], gpnorm );
             tm->AddTri( gp[2], gp[0], gp[1], gpnorm );
@@ -2844,58 +2677,30 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
             gp[m].offset_z( center.z() );
         }
 
+        plane_norm_vec.push_back( gpnorm );
+        plane_pnt_vec.push_back( vec3d( xcenter, center.y(), center.z() ) );
+
         // Build triangles
         tm->AddTri( gp[2], gp[3], gp[0], gpnorm );
         tm->AddTri( gp[2], gp[0], gp[1], gpnorm );
     }
 
-    //==== Load Bnding Box ====//
-    for ( int islice = 0 ; islice < ( int )m_SliceVec.size() ; islice++ )
+    //==== One Slicer Per Cone Angle, Plus One For The X Normal Tube Slices ====//
+    int ntheta_plane = numSlices * coneSections;
+    vector< MeshSlicer > slicer_vec( coneSections + 1 );
+    ParallelFor( ( int )slicer_vec.size(), [&]( int k )
     {
-        TMesh* tm = m_SliceVec[islice];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( int j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
+        int iplane = ( k < coneSections ) ? k : ntheta_plane;
+        slicer_vec[k].Build( m_TMeshVec, plane_norm_vec[iplane] );
+    } );
 
-        //==== Determine Which Triangles Are Interior/Exterior ====//
-        tm->WaveDeterIntExt( m_TMeshVec );
-
-        //==== Flip Int/Ext Flags ====//
-        for ( int i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
-        {
-            TTri* tri = tm->m_TVec[i];
-            if ( tri->m_SplitVec.size() )
-            {
-                for ( int j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                {
-                    tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
-                }
-            }
-            else
-            {
-                tri->m_InteriorFlag = !( tri->m_InteriorFlag );
-            }
-        }
-    }
+    //==== Cut Every Plane Independently ====//
+    vector< MeshSlice > cut_vec( m_SliceVec.size() );
+    ParallelFor( ( int )m_SliceVec.size(), [&]( int iplane )
+    {
+        const MeshSlicer & slicer = slicer_vec[ ( iplane < ntheta_plane ) ? iplane % coneSections : coneSections ];
+        slicer.Slice( dot( slicer.GetNorm(), plane_pnt_vec[iplane] ), cut_vec[iplane], true );
+    } );
 
     //==== Pushback slice and area results ====//
     // Make ID lookup map.
@@ -2905,14 +2710,32 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         compIdMap[ compIdVec[icomp] ] = icomp;
     }
 
-    m_SliceVec[numSlices*coneSections]->m_CompAreaVec.resize( compIdVec.size() );
-    double inA = m_SliceVec[numSlices*coneSections]->ComputeWaveDragArea( compIdMap );
-    WaveDragMgr.m_InletArea = inA;
+    for ( int iplane = 0 ; iplane < ( int )m_SliceVec.size() ; iplane++ )
+    {
+        TMesh* tm = m_SliceVec[iplane];
+        const MeshSlice & cut = cut_vec[iplane];
+
+        LoadSliceTris( tm, cut, m_TMeshVec );
+
+        // Areas are projected onto the YZ plane.
+        double yz_fract = std::abs( plane_norm_vec[iplane].x() );
+
+        tm->m_WetArea = cut.m_Area * yz_fract;
+        tm->m_AreaCenter = cut.m_AreaCenter;
+        tm->m_CompAreaVec.assign( compIdVec.size(), 0.0 );
 
-    m_SliceVec[numSlices*coneSections+1]->m_CompAreaVec.resize( compIdVec.size() );
-    double exA = m_SliceVec[numSlices*coneSections+1]->ComputeWaveDragArea( compIdMap );
-    WaveDragMgr.m_ExitArea = exA;
+        for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            std::map<string, int>::const_iterator it = compIdMap.find( m_TMeshVec[i]->m_PtrID );
+            if ( it != compIdMap.end() )
+            {
+                tm->m_CompAreaVec[ it->second ] += cut.m_MeshAreaVec[i] * yz_fract;
+            }
+        }
+    }
 
+    WaveDragMgr.m_InletArea = m_SliceVec[ntheta_plane]->m_WetArea;
+    WaveDragMgr.m_ExitArea = m_SliceVec[ntheta_plane + 1]->m_WetArea;
 
     for ( int islice = 0 ; islice < numSlices ; islice++ )
     {
@@ -2920,9 +2743,6 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         {
             int sindex = ( int )( islice * coneSections + itheta );
 
-            m_SliceVec[sindex]->m_CompAreaVec.resize( compIdVec.size() );
-            m_SliceVec[sindex]->ComputeWaveDragArea( compIdMap );
-
             for ( int icomp = 0; icomp < compIdVec.size(); icomp++ )
             {
                 WaveDragMgr.m_CompSliceAreaDist[itheta][icomp][islice]= m_SliceVec[sindex]->m_CompAreaVec[icomp];
@@ -3146,13 +2966,7 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         tMeshVec.erase( tMeshVec.begin(), tMeshVec.end() );
     *********/
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -3166,138 +2980,126 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
     }
 
-    //==== Do Shell Calcs ====//
-    vector< TriShellMassProp* > triShellVec;
-    for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
+    //==== Mesh IDs Are Unique, So Each Mesh Is A Component ====//
+    int ncomp = ( int )m_TMeshVec.size();
+    std::map< string, int > compIdMap;
+    for ( i = 0 ; i < ncomp ; i++ )
     {
-        TMesh* tm = m_TMeshVec[s];
-        if ( tm->m_ShellFlag )
+        compIdMap[ m_TMeshVec[i]->m_PtrID ] = i;
+    }
+
+    //==== Tasks Are The Meshes (Shells) Then The Slices (Prisms) ====//
+    //==== Each Task Sums Into Its Own Slots - One Per Comp Plus One For Unowned Mass ====//
+    vec3d ref = m_BBox.GetCenter();
+    int ntask = ncomp + ( int )m_SliceVec.size();
+    vector< vector< MassPropSum > > task_sum_vec( ntask );
+    vector< double > task_min_den( ntask, 1.0e06 );
+    vector< double > task_max_den( ntask, 0.0 );
+    double prismLength = sliceW;
+
+    ParallelFor( ntask, [&]( int itask )
+    {
+        vector< MassPropSum > & sum_vec = task_sum_vec[itask];
+
+        //==== Do Shell Calcs ====//
+        if ( itask < ncomp )
         {
-            for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+            TMesh* tm = m_TMeshVec[itask];
+            if ( !tm->m_ShellFlag )
+            {
+                return;
+            }
+
+            sum_vec.assign( 1, MassPropSum( ref ) );
+            for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
             {
-                TTri* tri = tm->m_TVec[i];
+                TTri* tri = tm->m_TVec[t];
                 if ( tri->m_SplitVec.size() )
                 {
-                    for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                    for ( int k = 0 ; k < ( int )tri->m_SplitVec.size() ; k++ )
                     {
-                        if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
+                        TTri* s_tri = tri->m_SplitVec[k];
+                        if ( s_tri->m_InteriorFlag == 0 )
                         {
-                            TriShellMassProp* tsmp = new TriShellMassProp( tm->m_PtrID, tm->m_ShellMassArea,
-                                    tri->m_SplitVec[j]->m_N0->m_Pnt,
-                                    tri->m_SplitVec[j]->m_N1->m_Pnt,
-                                    tri->m_SplitVec[j]->m_N2->m_Pnt );
-                            triShellVec.push_back( tsmp );
+                            sum_vec[0].AddTriShell( tm->m_ShellMassArea, s_tri->m_N0->m_Pnt, s_tri->m_N1->m_Pnt, s_tri->m_N2->m_Pnt );
                         }
                     }
                 }
                 else if ( tri->m_InteriorFlag == 0 )
                 {
-                    TriShellMassProp* tsmp = new TriShellMassProp( tm->m_PtrID, tm->m_ShellMassArea,
-                            tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
-                    triShellVec.push_back( tsmp );
+                    sum_vec[0].AddTriShell( tm->m_ShellMassArea, tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
                 }
             }
+            return;
         }
-    }
 
-    //==== Build Tetrahedrons ====//
-    double prismLength = sliceW;
-    vector< TetraMassProp* > tetraVec;
-    m_MinTriDen = 1.0e06;
-    m_MaxTriDen = 0.0;
-
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+        //==== Build Prisms From Interior Slice Tris ====//
+        vector< TTri* > int_tri_vec;
+        TMesh* tm = m_SliceVec[itask - ncomp];
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
         {
-            TTri* tri = tm->m_TVec[i];
-
+            TTri* tri = tm->m_TVec[t];
             if ( tri->m_SplitVec.size() )
             {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                for ( int k = 0 ; k < ( int )tri->m_SplitVec.size() ; k++ )
                 {
-                    if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
+                    if ( tri->m_SplitVec[k]->m_InteriorFlag == 0 )
                     {
-                        CreatePrism( tetraVec, tri->m_SplitVec[j], prismLength );
+                        int_tri_vec.push_back( tri->m_SplitVec[k] );
                     }
                 }
             }
             else if ( tri->m_InteriorFlag == 0 )
             {
-                CreatePrism( tetraVec, tri, prismLength );
+                int_tri_vec.push_back( tri );
             }
         }
-    }
 
-    //==== Add in Point Masses ====//
-    for ( i = 0 ; i < ( int )m_PointMassVec.size() ; i++ )
-    {
-        tetraVec.push_back( m_PointMassVec[i] );
-    }
+        sum_vec.assign( ncomp + 1, MassPropSum( ref ) );
+        for ( int t = 0 ; t < ( int )int_tri_vec.size() ; t++ )
+        {
+            TTri* tri = int_tri_vec[t];
 
-    double totalVol = 0.0;
-    for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-    {
-        totalVol += std::abs( tetraVec[i]->m_Vol );
-    }
+            std::map< string, int >::const_iterator it = compIdMap.find( tri->m_ID );
+            int icomp = ( it != compIdMap.end() ) ? it->second : ncomp;
+            CreatePrism( sum_vec[icomp], tri, prismLength );
 
-    vec3d cg( 0, 0, 0 );
-    m_TotalMass = 0.0;
-    for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-    {
-        m_TotalMass += tetraVec[i]->m_Mass;
-        cg = cg + tetraVec[i]->m_CG * tetraVec[i]->m_Mass;
-    }
-    for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
+            task_min_den[itask] = std::min( task_min_den[itask], tri->m_Mass );
+            task_max_den[itask] = std::max( task_max_den[itask], tri->m_Mass );
+        }
+    } );
+
+    //==== Reduce In Task Order So Results Do Not Depend On Thread Timing ====//
+    vector< MassPropSum > comp_sum_vec( ncomp + 1, MassPropSum( ref ) );
+    m_MinTriDen = 1.0e06;
+    m_MaxTriDen = 0.0;
+    for ( int itask = 0 ; itask < ntask ; itask++ )
     {
-        m_TotalMass += triShellVec[i]->m_Mass;
-        cg = cg + triShellVec[i]->m_CG * triShellVec[i]->m_Mass;
+        const vector< MassPropSum > & sum_vec = task_sum_vec[itask];
+        for ( int c = 0 ; c < ( int )sum_vec.size() ; c++ )
+        {
+            comp_sum_vec[ ( itask < ncomp ) ? itask : c ].Add( sum_vec[c] );
+        }
+        m_MinTriDen = std::min( m_MinTriDen, task_min_den[itask] );
+        m_MaxTriDen = std::max( m_MaxTriDen, task_max_den[itask] );
     }
 
-    if ( m_TotalMass )
+    //==== Add in Point Masses ====//
+    for ( i = 0 ; i < ( int )m_PointMassVec.size() ; i++ )
     {
-        cg = cg * ( 1.0 / m_TotalMass );
+        comp_sum_vec[ncomp].AddPointMass( m_PointMassVec[i]->m_Mass, m_PointMassVec[i]->m_CG );
     }
 
-    m_CenterOfGrav = cg;
-
-    m_TotalIxx = m_TotalIyy = m_TotalIzz = 0.0;
-    m_TotalIxy = m_TotalIxz = m_TotalIyz = 0.0;
-    for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
+    MassPropSum total_sum( ref );
+    for ( i = 0 ; i < ( int )comp_sum_vec.size() ; i++ )
     {
-        TetraMassProp* tet = tetraVec[i];
-        m_TotalIxx += tet->m_Ixx +
-                      tet->m_Mass * ( ( cg.y() - tet->m_CG.y() ) * ( cg.y() - tet->m_CG.y() ) + ( cg.z() - tet->m_CG.z() ) * ( cg.z() - tet->m_CG.z() ) );
-        m_TotalIyy += tet->m_Iyy +
-                      tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.x() - tet->m_CG.x() ) + ( cg.z() - tet->m_CG.z() ) * ( cg.z() - tet->m_CG.z() ) );
-        m_TotalIzz += tet->m_Izz +
-                      tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.x() - tet->m_CG.x() ) + ( cg.y() - tet->m_CG.y() ) * ( cg.y() - tet->m_CG.y() ) );
-
-        m_TotalIxy += tet->m_Ixy +
-                      tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.y() - tet->m_CG.y() ) );
-        m_TotalIxz += tet->m_Ixz +
-                      tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.z() - tet->m_CG.z() ) );
-        m_TotalIyz += tet->m_Iyz +
-                      tet->m_Mass * ( ( cg.y() - tet->m_CG.y() ) * ( cg.z() - tet->m_CG.z() ) );
+        total_sum.Add( comp_sum_vec[i] );
     }
-    for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
-    {
-        TriShellMassProp* trs = triShellVec[i];
-        m_TotalIxx += trs->m_Ixx +
-                      trs->m_Mass * ( ( cg.y() - trs->m_CG.y() ) * ( cg.y() - trs->m_CG.y() ) + ( cg.z() - trs->m_CG.z() ) * ( cg.z() - trs->m_CG.z() ) );
-        m_TotalIyy += trs->m_Iyy +
-                      trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.x() - trs->m_CG.x() ) + ( cg.z() - trs->m_CG.z() ) * ( cg.z() - trs->m_CG.z() ) );
-        m_TotalIzz += trs->m_Izz +
-                      trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.x() - trs->m_CG.x() ) + ( cg.y() - trs->m_CG.y() ) * ( cg.y() - trs->m_CG.y() ) );
 
-        m_TotalIxy += trs->m_Ixy +
-                      trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.y() - trs->m_CG.y() ) );
-        m_TotalIxz += trs->m_Ixz +
-                      trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.z() - trs->m_CG.z() ) );
-        m_TotalIyz += trs->m_Iyz +
-                      trs->m_Mass * ( ( cg.y() - trs->m_CG.y() ) * ( cg.z() - trs->m_CG.z() ) );
-    }
+    double totalVol = total_sum.GetVol();
+    m_TotalMass = total_sum.GetMass();
+    m_CenterOfGrav = total_sum.GetCG();
+    total_sum.GetInertia( m_TotalIxx, m_TotalIyy, m_TotalIzz, m_TotalIxy, m_TotalIxz, m_TotalIyz );
 
     vector< string > name_vec;
     vector< string > id_vec;
@@ -3311,103 +3113,26 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     vector< double > iyz_vec;
     vector< double > vol_vec;
 
-    for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
+    for ( s = 0 ; s < ncomp ; s++ )
     {
         TMesh* tm = m_TMeshVec[s];
-        string id = tm->m_PtrID;
-        id_vec.push_back( id );
-
-        double compVol = 0.0;
-        for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-        {
-            if ( !tetraVec[i]->m_CompId.compare( id ) )
-            {
-                compVol += std::abs( tetraVec[i]->m_Vol );
-            }
-        }
+        const MassPropSum & comp_sum = comp_sum_vec[s];
 
-        cg = vec3d( 0, 0, 0 );
-        double compMass = 0.0;
-        for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-        {
-            if ( !tetraVec[i]->m_CompId.compare( id ) )
-            {
-                compMass += tetraVec[i]->m_Mass;
-                cg = cg + tetraVec[i]->m_CG * tetraVec[i]->m_Mass;
-            }
-        }
-        for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
-        {
-            if ( !triShellVec[i]->m_CompId.compare( id ) )
-            {
-                compMass += triShellVec[i]->m_Mass;
-                cg = cg + triShellVec[i]->m_CG * triShellVec[i]->m_Mass;
-            }
-        }
-
-        if ( compMass )
-        {
-            cg = cg * ( 1.0 / compMass );
-        }
-
-        double compIxx = 0.0;
-        double compIyy = 0.0;
-        double compIzz = 0.0;
-        double compIxy = 0.0;
-        double compIxz = 0.0;
-        double compIyz = 0.0;
-        for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-        {
-            TetraMassProp* tet = tetraVec[i];
-            if ( !tet->m_CompId.compare( id ) )
-            {
-                compIxx += tet->m_Ixx +
-                           tet->m_Mass * ( ( cg.y() - tet->m_CG.y() ) * ( cg.y() - tet->m_CG.y() ) + ( cg.z() - tet->m_CG.z() ) * ( cg.z() - tet->m_CG.z() ) );
-                compIyy += tet->m_Iyy +
-                           tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.x() - tet->m_CG.x() ) + ( cg.z() - tet->m_CG.z() ) * ( cg.z() - tet->m_CG.z() ) );
-                compIzz += tet->m_Izz +
-                           tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.x() - tet->m_CG.x() ) + ( cg.y() - tet->m_CG.y() ) * ( cg.y() - tet->m_CG.y() ) );
-
-                compIxy += tet->m_Ixy +
-                           tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.y() - tet->m_CG.y() ) );
-                compIxz += tet->m_Ixz +
-                           tet->m_Mass * ( ( cg.x() - tet->m_CG.x() ) * ( cg.z() - tet->m_CG.z() ) );
-                compIyz += tet->m_Iyz +
-                           tet->m_Mass * ( ( cg.y() - tet->m_CG.y() ) * ( cg.z() - tet->m_CG.z() ) );
-            }
-        }
-        for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
-        {
-            TriShellMassProp* trs = triShellVec[i];
-            if ( !trs->m_CompId.compare( id ) )
-            {
-                compIxx += trs->m_Ixx +
-                           trs->m_Mass * ( ( cg.y() - trs->m_CG.y() ) * ( cg.y() - trs->m_CG.y() ) + ( cg.z() - trs->m_CG.z() ) * ( cg.z() - trs->m_CG.z() ) );
-                compIyy += trs->m_Iyy +
-                           trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.x() - trs->m_CG.x() ) + ( cg.z() - trs->m_CG.z() ) * ( cg.z() - trs->m_CG.z() ) );
-                compIzz += trs->m_Izz +
-                           trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.x() - trs->m_CG.x() ) + ( cg.y() - trs->m_CG.y() ) * ( cg.y() - trs->m_CG.y() ) );
-
-                compIxy += trs->m_Ixy +
-                           trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.y() - trs->m_CG.y() ) );
-                compIxz += trs->m_Ixz +
-                           trs->m_Mass * ( ( cg.x() - trs->m_CG.x() ) * ( cg.z() - trs->m_CG.z() ) );
-                compIyz += trs->m_Iyz +
-                           trs->m_Mass * ( ( cg.y() - trs->m_CG.y() ) * ( cg.z() - trs->m_CG.z() ) );
-            }
-        }
+        double compIxx, compIyy, compIzz, compIxy, compIxz, compIyz;
+        comp_sum.GetInertia( compIxx, compIyy, compIzz, compIxy, compIxz, compIyz );
 
         //==== Load Component Results ====//
         name_vec.push_back( tm->m_NameStr );
-        mass_vec.push_back( compMass );
-        cg_vec.push_back( cg );
+        id_vec.push_back( tm->m_PtrID );
+        mass_vec.push_back( comp_sum.GetMass() );
+        cg_vec.push_back( comp_sum.GetCG() );
         ixx_vec.push_back( compIxx );
         iyy_vec.push_back( compIyy );
         izz_vec.push_back( compIzz );
         ixy_vec.push_back( compIxy );
         ixz_vec.push_back( compIxz );
         iyz_vec.push_back( compIyz );
-        vol_vec.push_back( compVol );
+        vol_vec.push_back( comp_sum.GetVol() );
     }
 
     res->Add( NameValData( "Num_Comps", ( int )name_vec.size() ) );
@@ -3435,15 +3160,11 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
     res->Add( NameValData( "Total_Volume", totalVol ) );
 
     //==== Clean Up Mess ====//
-    for ( i = 0 ; i < ( int )tetraVec.size() ; i++ )
-    {
-        delete tetraVec[i];
-    }
-
-    for ( i = 0 ; i < ( int )triShellVec.size() ; i++ )
+    for ( i = 0 ; i < ( int )m_PointMassVec.size() ; i++ )
     {
-        delete triShellVec[i];
+        delete m_PointMassVec[i];
     }
+    m_PointMassVec.clear();
 
     //==== Get Rid of TMeshes  that are not shells ====//
     vector<TMesh*> newTMeshVec;
@@ -3566,13 +3287,7 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
 
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -3814,17 +3529,8 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
 }
 
 //==== Create a Prism Made of Tetras - Extrude Tri +- len/2 ====//
-void MeshGeom::CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, double len )
+void MeshGeom::CreatePrism( MassPropSum & sum, TTri* tri, double len )
 {
-    if ( tri->m_Mass < m_MinTriDen )
-    {
-        m_MinTriDen = tri->m_Mass;
-    }
-    if ( tri->m_Mass > m_MaxTriDen )
-    {
-        m_MaxTriDen = tri->m_Mass;
-    }
-
     vec3d cnt = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt + tri->m_N2->m_Pnt ) * ( 1.0 / 3.0 );
 
     vec3d p0 = tri->m_N0->m_Pnt;
@@ -3841,14 +3547,14 @@ void MeshGeom::CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, doubl
     p4.offset_x( -len / 2.0 );
     p5.offset_x( -len / 2.0 );
 
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p0, p1, p2 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p3, p4, p5 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p0, p1, p3 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p3, p4, p1 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p1, p2, p4 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p4, p5, p2 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p0, p2, p3 ) );
-    tetraVec.push_back( new TetraMassProp( tri->m_ID, tri->m_Mass, cnt, p3, p5, p2 ) );
+    sum.AddTetra( tri->m_Mass, cnt, p0, p1, p2 );
+    sum.AddTetra( tri->m_Mass, cnt, p3, p4, p5 );
+    sum.AddTetra( tri->m_Mass, cnt, p0, p1, p3 );
+    sum.AddTetra( tri->m_Mass, cnt, p3, p4, p1 );
+    sum.AddTetra( tri->m_Mass, cnt, p1, p2, p4 );
+    sum.AddTetra( tri->m_Mass, cnt, p4, p5, p2 );
+    sum.AddTetra( tri->m_Mass, cnt, p0, p2, p3 );
+    sum.AddTetra( tri->m_Mass, cnt, p3, p5, p2 );
 }
 
 //==== Create a Prism Made of DegenGeomTetras - Extrude Tri +- len/2 ====//
@@ -93,6 +93,10 @@ public:
     virtual void load_normals();
     virtual void UpdateBBox();
     virtual void UpdateDrawObj();
+    virtual bool UsesPreTess()
+    {
+        return false;
+    }
 
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
@@ -144,6 +148,7 @@ public:
 
     //==== Intersection, Splitting and Trimming ====//
     virtual void IntersectTrim( int halfFlag = 0, int intSubsFlag = 1 );
+    virtual void IntersectMeshPairs();
     virtual void degenGeomIntersectTrim( vector< DegenGeom > &degenGeom );
     virtual void MassSliceX( int numSlice, bool writefile = true );
     virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom );
@@ -160,7 +165,7 @@ public:
     virtual vec3d GetVertex3d( int surf, double x, double p, int r );
     //virtual void  getVertexVec(vector< VertexID > *vertVec);
 
-    virtual void CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, double len );
+    virtual void CreatePrism( MassPropSum & sum, TTri* tri, double len );
     virtual void createDegenGeomPrism( vector< DegenGeomTetraMassProp* >& tetraVec, TTri* tri, double len );
 
     virtual void AddPointMass( TetraMassProp* pm )
@@ -0,0 +1,572 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// MeshSlicer.cpp: Plane cross sections of closed triangle meshes.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "MeshSlicer.h"
+#include "TMesh.h"
+#include "BndBox.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <cmath>
+
+//==== Point Where An Edge Crosses The Plane - Same For Both Tris On The Edge ====//
+static vec3d EdgeCut( vec3d p0, double s0, vec3d p1, double s1 )
+{
+    bool swap_flag = false;
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        if ( p0[i] != p1[i] )
+        {
+            swap_flag = p1[i] < p0[i];
+            break;
+        }
+    }
+    if ( swap_flag )
+    {
+        std::swap( p0, p1 );
+        std::swap( s0, s1 );
+    }
+    return p0 + ( p1 - p0 ) * ( s0 / ( s0 - s1 ) );
+}
+
+static double Cross2D( const vec2d & a, const vec2d & b )
+{
+    return a[0] * b[1] - a[1] * b[0];
+}
+
+//==== U Along A Segment At Height v ====//
+static double UAtV( const vec2d & a, const vec2d & b, double v )
+{
+    if ( b[1] == a[1] )
+    {
+        return a[0];
+    }
+    return a[0] + ( b[0] - a[0] ) * ( v - a[1] ) / ( b[1] - a[1] );
+}
+
+MeshSlicer::MeshSlicer()
+{
+    m_MaxExtent = 0.0;
+}
+
+void MeshSlicer::Build( const vector< TMesh* > & mesh_vec, const vec3d & norm )
+{
+    m_Norm = norm;
+    m_Norm.normalize();
+
+    vec3d axis( 1.0, 0.0, 0.0 );
+    if ( std::abs( m_Norm.x() ) > 0.9 )
+    {
+        axis = vec3d( 0.0, 1.0, 0.0 );
+    }
+    m_UDir = cross( axis, m_Norm );
+    m_UDir.normalize();
+    m_VDir = cross( m_Norm, m_UDir );
+
+    BndBox box;
+    for ( int m = 0 ; m < ( int )mesh_vec.size() ; m++ )
+    {
+        for ( int t = 0 ; t < ( int )mesh_vec[m]->m_TVec.size() ; t++ )
+        {
+            TTri* tri = mesh_vec[m]->m_TVec[t];
+            box.Update( tri->m_N0->m_Pnt );
+            box.Update( tri->m_N1->m_Pnt );
+            box.Update( tri->m_N2->m_Pnt );
+        }
+    }
+    m_Ref = box.GetCenter();
+
+    m_TriVec.clear();
+    m_PriorVec.resize( mesh_vec.size() );
+    m_MaxExtent = 0.0;
+
+    for ( int m = 0 ; m < ( int )mesh_vec.size() ; m++ )
+    {
+        TMesh* tm = mesh_vec[m];
+        m_PriorVec[m] = tm->m_MassPrior;
+
+        //==== Orientation From The Sign Of The Enclosed Volume ====//
+        double vol = 0.0;
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tm->m_TVec[t];
+            vol += dot( tri->m_N0->m_Pnt - m_Ref, cross( tri->m_N1->m_Pnt - m_Ref, tri->m_N2->m_Pnt - m_Ref ) );
+        }
+        bool flip_flag = vol < 0.0;
+
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tm->m_TVec[t];
+
+            SliceTri st;
+            st.m_Pnt[0] = tri->m_N0->m_Pnt;
+            st.m_Pnt[1] = flip_flag ? tri->m_N2->m_Pnt : tri->m_N1->m_Pnt;
+            st.m_Pnt[2] = flip_flag ? tri->m_N1->m_Pnt : tri->m_N2->m_Pnt;
+            st.m_Mesh = m;
+
+            double d0 = dot( m_Norm, st.m_Pnt[0] );
+            double d1 = dot( m_Norm, st.m_Pnt[1] );
+            double d2 = dot( m_Norm, st.m_Pnt[2] );
+            st.m_DMin = std::min( d0, std::min( d1, d2 ) );
+            st.m_DMax = std::max( d0, std::max( d1, d2 ) );
+            m_MaxExtent = std::max( m_MaxExtent, st.m_DMax - st.m_DMin );
+
+            m_TriVec.push_back( st );
+        }
+    }
+
+    std::sort( m_TriVec.begin(), m_TriVec.end(), []( const SliceTri & a, const SliceTri & b )
+    {
+        return a.m_DMin < b.m_DMin;
+    } );
+}
+
+vec2d MeshSlicer::ToPlane( const vec3d & p ) const
+{
+    vec3d r = p - m_Ref;
+    return vec2d( dot( r, m_UDir ), dot( r, m_VDir ) );
+}
+
+vec3d MeshSlicer::FromPlane( const vec2d & p, double offset ) const
+{
+    return m_Ref + m_UDir * p[0] + m_VDir * p[1] + m_Norm * ( offset - dot( m_Norm, m_Ref ) );
+}
+
+void MeshSlicer::MeshCut::Build( const vector< SliceSeg > & seg_vec )
+{
+    m_Min = m_Max = seg_vec[ m_SegIndVec[0] ].m_A;
+    for ( int i = 0 ; i < ( int )m_SegIndVec.size() ; i++ )
+    {
+        const SliceSeg & seg = seg_vec[ m_SegIndVec[i] ];
+        for ( int k = 0 ; k < 2 ; k++ )
+        {
+            m_Min[k] = std::min( m_Min[k], std::min( seg.m_A[k], seg.m_B[k] ) );
+            m_Max[k] = std::max( m_Max[k], std::max( seg.m_A[k], seg.m_B[k] ) );
+        }
+    }
+
+    //==== About Two Segments Per Bin ====//
+    int nbin = std::max( 1, std::min( ( int )m_SegIndVec.size() / 2, 4096 ) );
+    m_BinV0 = m_Min[1];
+    m_BinDV = ( m_Max[1] - m_Min[1] ) / nbin;
+    if ( m_BinDV <= 0.0 )
+    {
+        nbin = 1;
+        m_BinDV = 1.0;
+    }
+    m_BinVec.assign( nbin, vector< int >() );
+
+    for ( int i = 0 ; i < ( int )m_SegIndVec.size() ; i++ )
+    {
+        const SliceSeg & seg = seg_vec[ m_SegIndVec[i] ];
+        int b0 = ( int )( ( std::min( seg.m_A[1], seg.m_B[1] ) - m_BinV0 ) / m_BinDV );
+        int b1 = ( int )( ( std::max( seg.m_A[1], seg.m_B[1] ) - m_BinV0 ) / m_BinDV );
+        b0 = std::max( 0, std::min( b0, nbin - 1 ) );
+        b1 = std::max( 0, std::min( b1, nbin - 1 ) );
+        for ( int b = b0 ; b <= b1 ; b++ )
+        {
+            m_BinVec[b].push_back( m_SegIndVec[i] );
+        }
+    }
+}
+
+//==== Even - Odd Test Along +U ====//
+bool MeshSlicer::MeshCut::Contains( const vector< SliceSeg > & seg_vec, const vec2d & pnt ) const
+{
+    if ( pnt[0] < m_Min[0] || pnt[0] > m_Max[0] || pnt[1] < m_Min[1] || pnt[1] > m_Max[1] )
+    {
+        return false;
+    }
+
+    int nbin = ( int )m_BinVec.size();
+    int b = std::max( 0, std::min( ( int )( ( pnt[1] - m_BinV0 ) / m_BinDV ), nbin - 1 ) );
+
+    bool inside = false;
+    const vector< int > & bin = m_BinVec[b];
+    for ( int i = 0 ; i < ( int )bin.size() ; i++ )
+    {
+        const SliceSeg & seg = seg_vec[ bin[i] ];
+        if ( ( seg.m_A[1] > pnt[1] ) != ( seg.m_B[1] > pnt[1] ) )
+        {
+            if ( UAtV( seg.m_A, seg.m_B, pnt[1] ) > pnt[0] )
+            {
+                inside = !inside;
+            }
+        }
+    }
+    return inside;
+}
+
+void MeshSlicer::MeshCut::FindCandidates( double vmin, double vmax, vector< int > & ind_vec ) const
+{
+    ind_vec.clear();
+    if ( vmax < m_Min[1] || vmin > m_Max[1] )
+    {
+        return;
+    }
+
+    int nbin = ( int )m_BinVec.size();
+    int b0 = std::max( 0, std::min( ( int )( ( vmin - m_BinV0 ) / m_BinDV ), nbin - 1 ) );
+    int b1 = std::max( 0, std::min( ( int )( ( vmax - m_BinV0 ) / m_BinDV ), nbin - 1 ) );
+    for ( int b = b0 ; b <= b1 ; b++ )
+    {
+        ind_vec.insert( ind_vec.end(), m_BinVec[b].begin(), m_BinVec[b].end() );
+    }
+    if ( b1 > b0 )
+    {
+        std::sort( ind_vec.begin(), ind_vec.end() );
+        ind_vec.erase( std::unique( ind_vec.begin(), ind_vec.end() ), ind_vec.end() );
+    }
+}
+
+void MeshSlicer::Slice( double offset, MeshSlice & slice, bool tri_flag ) const
+{
+    int num_mesh = ( int )m_PriorVec.size();
+
+    slice = MeshSlice();
+    slice.m_MeshAreaVec.assign( num_mesh, 0.0 );
+    slice.m_AreaCenter = FromPlane( vec2d( 0.0, 0.0 ), offset );
+
+    //==== Segments Of Crossed Tris - Only Tris Starting Within m_MaxExtent Can Reach ====//
+    vector< SliceSeg > seg_vec;
+    vector< SliceTri >::const_iterator it = std::lower_bound( m_TriVec.begin(), m_TriVec.end(), offset - m_MaxExtent,
+                                            []( const SliceTri & t, double d )
+    {
+        return t.m_DMin < d;
+    } );
+
+    for ( ; it != m_TriVec.end() && it->m_DMin < offset ; ++it )
+    {
+        const SliceTri & st = *it;
+        if ( st.m_DMax < offset )
+        {
+            continue;
+        }
+
+        double s[3];
+        bool pos[3];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            s[k] = dot( m_Norm, st.m_Pnt[k] ) - offset;
+            pos[k] = s[k] >= 0.0;
+        }
+
+        //==== The Vertex Alone On Its Side ====//
+        int lone = ( pos[0] == pos[1] ) ? 2 : ( ( pos[0] == pos[2] ) ? 1 : 0 );
+        int j = ( lone + 1 ) % 3;
+        int k = ( lone + 2 ) % 3;
+
+        vec3d c0 = EdgeCut( st.m_Pnt[lone], s[lone], st.m_Pnt[j], s[j] );
+        vec3d c1 = EdgeCut( st.m_Pnt[lone], s[lone], st.m_Pnt[k], s[k] );
+
+        SliceSeg seg;
+        seg.m_Mesh = st.m_Mesh;
+        seg.m_A = ToPlane( pos[lone] ? c0 : c1 );
+        seg.m_B = ToPlane( pos[lone] ? c1 : c0 );
+        seg_vec.push_back( seg );
+    }
+
+    if ( seg_vec.empty() )
+    {
+        return;
+    }
+
+    vector< MeshCut > cut_vec( num_mesh );
+    for ( int i = 0 ; i < ( int )seg_vec.size() ; i++ )
+    {
+        cut_vec[ seg_vec[i].m_Mesh ].m_SegIndVec.push_back( i );
+    }
+
+    vector< int > cut_mesh_vec;
+    for ( int m = 0 ; m < num_mesh ; m++ )
+    {
+        if ( cut_vec[m].m_SegIndVec.size() )
+        {
+            cut_vec[m].Build( seg_vec );
+            cut_mesh_vec.push_back( m );
+        }
+    }
+
+    //==== Split Each Segment Where Other Meshes Cross It, Classify The Pieces ====//
+    double area = 0.0;
+    double mom_u = 0.0;
+    double mom_v = 0.0;
+    vector< vector< SliceSeg > > own_vec;   // Boundary of the area owned by each mesh
+    if ( tri_flag )
+    {
+        own_vec.resize( num_mesh );
+    }
+
+    vector< int > near_vec;
+    vector< int > cand_vec;
+    vector< int > in_vec;
+    vector< double > t_vec;
+
+    for ( int i = 0 ; i < ( int )seg_vec.size() ; i++ )
+    {
+        const SliceSeg & seg = seg_vec[i];
+        int m = seg.m_Mesh;
+
+        vec2d smin( std::min( seg.m_A[0], seg.m_B[0] ), std::min( seg.m_A[1], seg.m_B[1] ) );
+        vec2d smax( std::max( seg.m_A[0], seg.m_B[0] ), std::max( seg.m_A[1], seg.m_B[1] ) );
+
+        near_vec.clear();
+        for ( int c = 0 ; c < ( int )cut_mesh_vec.size() ; c++ )
+        {
+            const MeshCut & cut = cut_vec[ cut_mesh_vec[c] ];
+            if ( cut_mesh_vec[c] != m &&
+                 smax[0] >= cut.m_Min[0] && smin[0] <= cut.m_Max[0] &&
+                 smax[1] >= cut.m_Min[1] && smin[1] <= cut.m_Max[1] )
+            {
+                near_vec.push_back( cut_mesh_vec[c] );
+            }
+        }
+
+        t_vec.clear();
+        t_vec.push_back( 0.0 );
+        t_vec.push_back( 1.0 );
+
+        vec2d r = seg.m_B - seg.m_A;
+        for ( int n = 0 ; n < ( int )near_vec.size() ; n++ )
+        {
+            cut_vec[ near_vec[n] ].FindCandidates( smin[1], smax[1], cand_vec );
+            for ( int c = 0 ; c < ( int )cand_vec.size() ; c++ )
+            {
+                const SliceSeg & other = seg_vec[ cand_vec[c] ];
+                vec2d q = other.m_B - other.m_A;
+                double den = Cross2D( r, q );
+                if ( den == 0.0 )
+                {
+                    continue;
+                }
+                vec2d w = other.m_A - seg.m_A;
+                double ts = Cross2D( w, q ) / den;
+                double tt = Cross2D( w, r ) / den;
+                if ( ts > 0.0 && ts < 1.0 && tt >= 0.0 && tt <= 1.0 )
+                {
+                    t_vec.push_back( ts );
+                }
+            }
+        }
+        std::sort( t_vec.begin(), t_vec.end() );
+
+        for ( int p = 0 ; p < ( int )t_vec.size() - 1 ; p++ )
+        {
+            if ( t_vec[p + 1] <= t_vec[p] )
+            {
+                continue;
+            }
+
+            vec2d pa = ( p == 0 ) ? seg.m_A : seg.m_A + r * t_vec[p];
+            vec2d pb = ( p == ( int )t_vec.size() - 2 ) ? seg.m_B : seg.m_A + r * t_vec[p + 1];
+            vec2d mid = ( pa + pb ) * 0.5;
+
+            in_vec.clear();
+            for ( int n = 0 ; n < ( int )near_vec.size() ; n++ )
+            {
+                if ( cut_vec[ near_vec[n] ].Contains( seg_vec, mid ) )
+                {
+                    in_vec.push_back( near_vec[n] );
+                }
+            }
+
+            //==== Green's Theorem Over The Piece ====//
+            double cr = Cross2D( pa, pb );
+            double a = 0.5 * cr;
+
+            if ( in_vec.empty() )
+            {
+                area += a;
+                mom_u += ( pa[0] + pb[0] ) * cr;
+                mom_v += ( pa[1] + pb[1] ) * cr;
+            }
+
+            //==== Owner Of A Point Is The Top Mesh Containing It ====//
+            bool top_flag = true;
+            for ( int n = 0 ; n < ( int )in_vec.size() ; n++ )
+            {
+                if ( Beats( in_vec[n], m ) )
+                {
+                    top_flag = false;
+                }
+            }
+            if ( top_flag )
+            {
+                slice.m_MeshAreaVec[m] += a;
+
+                if ( tri_flag )
+                {
+                    SliceSeg piece;
+                    piece.m_A = pa;
+                    piece.m_B = pb;
+                    piece.m_Mesh = m;
+                    own_vec[m].push_back( piece );
+                }
+            }
+
+            //==== Piece Also Bounds, Reversed, What It Takes From Lower Meshes ====//
+            for ( int n = 0 ; n < ( int )in_vec.size() ; n++ )
+            {
+                int low = in_vec[n];
+                if ( !Beats( m, low ) )
+                {
+                    continue;
+                }
+
+                bool next_flag = true;
+                for ( int o = 0 ; o < ( int )in_vec.size() ; o++ )
+                {
+                    if ( in_vec[o] != low && Beats( in_vec[o], low ) )
+                    {
+                        next_flag = false;
+                    }
+                }
+                if ( next_flag )
+                {
+                    slice.m_MeshAreaVec[low] -= a;
+
+                    if ( tri_flag )
+                    {
+                        SliceSeg piece;
+                        piece.m_A = pb;
+                        piece.m_B = pa;
+                        piece.m_Mesh = low;
+                        own_vec[low].push_back( piece );
+                    }
+                }
+            }
+        }
+    }
+
+    slice.m_Area = area;
+    if ( area > 0.0 )
+    {
+        slice.m_AreaCenter = FromPlane( vec2d( mom_u / ( 6.0 * area ), mom_v / ( 6.0 * area ) ), offset );
+    }
+
+    //==== Tris Per Owner, So Each Carries The Mesh Whose Area It Covers ====//
+    if ( tri_flag )
+    {
+        for ( int o = 0 ; o < num_mesh ; o++ )
+        {
+            BuildTris( own_vec[o], offset, slice.m_TriPntVec );
+            slice.m_TriMeshVec.resize( slice.m_TriPntVec.size() / 3, o );
+        }
+    }
+}
+
+//==== Trapezoids Between Boundary Pieces, Split Into Tris ====//
+void MeshSlicer::BuildTris( const vector< SliceSeg > & piece_vec, double offset, vector< vec3d > & tri_pnt_vec ) const
+{
+    vector< double > v_vec;
+    vector< int > order_vec;
+    for ( int i = 0 ; i < ( int )piece_vec.size() ; i++ )
+    {
+        if ( piece_vec[i].m_A[1] != piece_vec[i].m_B[1] )
+        {
+            v_vec.push_back( piece_vec[i].m_A[1] );
+            v_vec.push_back( piece_vec[i].m_B[1] );
+            order_vec.push_back( i );
+        }
+    }
+    std::sort( v_vec.begin(), v_vec.end() );
+    v_vec.erase( std::unique( v_vec.begin(), v_vec.end() ), v_vec.end() );
+
+    std::sort( order_vec.begin(), order_vec.end(), [&]( int a, int b )
+    {
+        return std::min( piece_vec[a].m_A[1], piece_vec[a].m_B[1] ) < std::min( piece_vec[b].m_A[1], piece_vec[b].m_B[1] );
+    } );
+
+    auto emit_trap = [&]( int left, int right, double va, double vb )
+    {
+        const SliceSeg & l = piece_vec[left];
+        const SliceSeg & r = piece_vec[right];
+        vec2d la( UAtV( l.m_A, l.m_B, va ), va );
+        vec2d lb( UAtV( l.m_A, l.m_B, vb ), vb );
+        vec2d ra( UAtV( r.m_A, r.m_B, va ), va );
+        vec2d rb( UAtV( r.m_A, r.m_B, vb ), vb );
+
+        if ( Cross2D( ra - la, rb - la ) > 0.0 )
+        {
+            tri_pnt_vec.push_back( FromPlane( la, offset ) );
+            tri_pnt_vec.push_back( FromPlane( ra, offset ) );
+            tri_pnt_vec.push_back( FromPlane( rb, offset ) );
+        }
+        if ( Cross2D( rb - la, lb - la ) > 0.0 )
+        {
+            tri_pnt_vec.push_back( FromPlane( la, offset ) );
+            tri_pnt_vec.push_back( FromPlane( rb, offset ) );
+            tri_pnt_vec.push_back( FromPlane( lb, offset ) );
+        }
+    };
+
+    //==== Sweep Up In V - A Trapezoid Stays Open While The Same Two Pieces Bound It ====//
+    typedef std::map< std::pair< int, int >, double > TrapMap;
+    TrapMap open_map;
+    TrapMap curr_map;
+    vector< int > active_vec;
+    vector< std::pair< double, int > > span_vec;
+    int next = 0;
+
+    for ( int s = 0 ; s < ( int )v_vec.size() - 1 ; s++ )
+    {
+        double v0 = v_vec[s];
+        double v1 = v_vec[s + 1];
+
+        while ( next < ( int )order_vec.size() &&
+                std::min( piece_vec[ order_vec[next] ].m_A[1], piece_vec[ order_vec[next] ].m_B[1] ) <= v0 )
+        {
+            active_vec.push_back( order_vec[next] );
+            next++;
+        }
+
+        int nactive = 0;
+        for ( int a = 0 ; a < ( int )active_vec.size() ; a++ )
+        {
+            const SliceSeg & piece = piece_vec[ active_vec[a] ];
+            if ( std::max( piece.m_A[1], piece.m_B[1] ) > v0 )
+            {
+                active_vec[nactive++] = active_vec[a];
+            }
+        }
+        active_vec.resize( nactive );
+
+        double vm = 0.5 * ( v0 + v1 );
+        span_vec.clear();
+        for ( int a = 0 ; a < ( int )active_vec.size() ; a++ )
+        {
+            const SliceSeg & piece = piece_vec[ active_vec[a] ];
+            span_vec.push_back( std::make_pair( UAtV( piece.m_A, piece.m_B, vm ), active_vec[a] ) );
+        }
+        std::sort( span_vec.begin(), span_vec.end() );
+
+        curr_map.clear();
+        for ( int k = 0 ; k < ( int )span_vec.size() - 1 ; k += 2 )
+        {
+            std::pair< int, int > key( span_vec[k].second, span_vec[k + 1].second );
+            TrapMap::iterator f = open_map.find( key );
+            curr_map[key] = ( f != open_map.end() ) ? f->second : v0;
+        }
+
+        for ( TrapMap::iterator f = open_map.begin() ; f != open_map.end() ; ++f )
+        {
+            if ( curr_map.find( f->first ) == curr_map.end() )
+            {
+                emit_trap( f->first.first, f->first.second, f->second, v0 );
+            }
+        }
+        open_map.swap( curr_map );
+    }
+
+    for ( TrapMap::iterator f = open_map.begin() ; f != open_map.end() ; ++f )
+    {
+        emit_trap( f->first.first, f->first.second, f->second, v_vec.back() );
+    }
+}
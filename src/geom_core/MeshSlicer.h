@@ -0,0 +1,115 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// MeshSlicer.h
+//
+// Cuts a set of closed triangle meshes with parallel planes.  The tris are
+// sorted along the plane normal once, so each plane only visits the tris
+// it crosses, and cross sections come straight from the edge - plane
+// crossings instead of intersecting and splitting a mesh for each plane.
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(MESH_SLICER__INCLUDED_)
+#define MESH_SLICER__INCLUDED_
+
+#include "Vec2d.h"
+#include "Vec3d.h"
+
+#include <vector>
+using std::vector;
+
+class TMesh;
+
+//==== Cross Section Of All Meshes On One Plane ====//
+class MeshSlice
+{
+public:
+
+    MeshSlice()
+    {
+        m_Area = 0.0;
+    }
+
+    double m_Area;                      // Area inside any mesh
+    vec3d m_AreaCenter;
+    vector< double > m_MeshAreaVec;     // Area owned by each mesh - highest m_MassPrior, then lowest index
+    vector< vec3d > m_TriPntVec;        // Tris covering m_Area, three points each
+    vector< int > m_TriMeshVec;         // Owning mesh of each tri
+};
+
+class MeshSlicer
+{
+public:
+
+    MeshSlicer();
+
+    //==== Copy The Tris Of Closed Meshes And Sort Them Along norm ====//
+    void Build( const vector< TMesh* > & mesh_vec, const vec3d & norm );
+
+    //==== Cut With The Plane dot( norm, p ) = offset - Read Only, So Planes May Run In Parallel ====//
+    void Slice( double offset, MeshSlice & slice, bool tri_flag ) const;
+
+    const vec3d & GetNorm() const
+    {
+        return m_Norm;
+    }
+
+protected:
+
+    class SliceTri
+    {
+    public:
+        vec3d m_Pnt[3];                 // Ordered so the normal points out of the mesh
+        double m_DMin;                  // Extent along m_Norm
+        double m_DMax;
+        int m_Mesh;
+    };
+
+    class SliceSeg
+    {
+    public:
+        vec2d m_A;                      // Mesh inside lies to the left of A -> B
+        vec2d m_B;
+        int m_Mesh;
+    };
+
+    //==== Segments Of One Mesh, Binned By Plane V For Crossing Queries ====//
+    class MeshCut
+    {
+    public:
+        void Build( const vector< SliceSeg > & seg_vec );
+        bool Contains( const vector< SliceSeg > & seg_vec, const vec2d & pnt ) const;
+        void FindCandidates( double vmin, double vmax, vector< int > & ind_vec ) const;
+
+        vector< int > m_SegIndVec;
+        vec2d m_Min;
+        vec2d m_Max;
+        double m_BinV0;
+        double m_BinDV;
+        vector< vector< int > > m_BinVec;
+    };
+
+    bool Beats( int a, int b ) const
+    {
+        return m_PriorVec[a] > m_PriorVec[b] || ( m_PriorVec[a] == m_PriorVec[b] && a < b );
+    }
+
+    vec2d ToPlane( const vec3d & p ) const;
+    vec3d FromPlane( const vec2d & p, double offset ) const;
+
+    void BuildTris( const vector< SliceSeg > & piece_vec, double offset, vector< vec3d > & tri_pnt_vec ) const;
+
+    vec3d m_Norm;
+    vec3d m_UDir;
+    vec3d m_VDir;
+    vec3d m_Ref;                        // Plane coordinates are relative to this point
+
+    vector< int > m_PriorVec;
+    vector< SliceTri > m_TriVec;        // Sorted by m_DMin
+    double m_MaxExtent;
+};
+
+#endif
@@ -177,7 +177,7 @@ double Parm::SetFromLink( double val )
 
     if ( m_Container )
     {
-        m_Container->ParmChanged( this, SET_FROM_LINK );
+        m_Container->ParmChanged( this, LinkMgr.IsBatchActive() ? SET : SET_FROM_LINK );
     }
 
     return m_Val;
@@ -568,7 +568,7 @@ double FractionParm::SetFromLink( double val )
 
     if ( m_Container )
     {
-        m_Container->ParmChanged( this, SET_FROM_LINK );
+        m_Container->ParmChanged( this, LinkMgr.IsBatchActive() ? SET : SET_FROM_LINK );
     }
 
 
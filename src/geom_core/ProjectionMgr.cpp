@@ -12,9 +12,47 @@
 #include "Vehicle.h"
 #include "StlHelper.h"
 #include "MeshGeom.h"
+#include "ParallelUtil.h"
 
 #include "triangle.h"
 
+#include <cmath>
+#include <stdint.h>
+
+//==== Round To The Nearest Clipper Integer Coordinate ====//
+static ClipperLib::cInt ToClipperInt( double v )
+{
+    return ( ClipperLib::cInt ) std::floor( v + 0.5 );
+}
+
+//==== Run Tasks On Worker Threads Or In Order On This One ====//
+static void RunTasks( int num_tasks, bool parallel, const std::function< void( int ) > & func )
+{
+    if ( parallel )
+    {
+        ParallelFor( num_tasks, func );
+    }
+    else
+    {
+        for ( int i = 0 ; i < num_tasks ; i++ )
+        {
+            func( i );
+        }
+    }
+}
+
+//==== Interleave The Low 16 Bits Of x And y ====//
+static uint32_t MortonKey( uint32_t x, uint32_t y )
+{
+    uint32_t key = 0;
+    for ( int b = 0 ; b < 16 ; b++ )
+    {
+        key |= ( ( x >> b ) & 1 ) << ( 2 * b );
+        key |= ( ( y >> b ) & 1 ) << ( 2 * b + 1 );
+    }
+    return key;
+}
+
 //==== Constructor ====//
 ProjectionMgrSingleton::ProjectionMgrSingleton()
 {
@@ -34,6 +72,8 @@ ProjectionMgrSingleton::ProjectionMgrSingleton()
 
 void ProjectionMgrSingleton::Init()
 {
+    m_ClipperRange = ClipperLib::loRange;
+    m_UnionBatchSize = 4096;
 }
 
 void ProjectionMgrSingleton::Wype()
@@ -482,6 +522,97 @@ Results* ProjectionMgrSingleton::Project( vector < TMesh* > &targetTMeshVec, vec
     return res;
 }
 
+Results* ProjectionMgrSingleton::ProjectAreas( int tset, const vector < vec3d > & dir_vec )
+{
+    vector < TMesh* > targetTMeshVec;
+
+    GetMesh( tset, targetTMeshVec );
+
+    Results* res = ProjectAreas( targetTMeshVec, dir_vec );
+    CleanMesh( targetTMeshVec );
+    return res;
+}
+
+Results* ProjectionMgrSingleton::ProjectAreas( const string &tgeom, const vector < vec3d > & dir_vec )
+{
+    vector < TMesh* > targetTMeshVec;
+
+    GetMesh( tgeom, targetTMeshVec );
+
+    Results* res = ProjectAreas( targetTMeshVec, dir_vec );
+    CleanMesh( targetTMeshVec );
+    return res;
+}
+
+Results* ProjectionMgrSingleton::ProjectAreas( vector < TMesh* > &targetTMeshVec, const vector < vec3d > & dir_vec )
+{
+    vector < double > area_vec( dir_vec.size(), 0.0 );
+
+    //==== One Direction Per Task - Meshes Are Only Read, Each Task Rotates Its Own Points ====//
+    ParallelFor( ( int )dir_vec.size(), [&]( int idir )
+    {
+        Matrix4d mat;
+        mat.rotatealongX( dir_vec[idir] );
+
+        BndBox box;
+        vector < vec3d > pnt_vec;
+        for ( int i = 0 ; i < ( int )targetTMeshVec.size() ; i++ )
+        {
+            for ( int j = 0 ; j < ( int )targetTMeshVec[i]->m_TVec.size() ; j++ )
+            {
+                for ( int k = 0; k < 3; k++ )
+                {
+                    pnt_vec.push_back( mat.xform( targetTMeshVec[i]->m_TVec[j]->GetTriNode( k )->m_Pnt ) );
+                    box.Update( pnt_vec.back() );
+                }
+            }
+        }
+
+        if ( pnt_vec.empty() )
+        {
+            return;
+        }
+
+        double scale = GetClipperScale( box );
+        vec3d center = box.GetCenter();
+
+        ClipperLib::Paths pths( pnt_vec.size() / 3 );
+        for ( int itri = 0 ; itri < ( int )pths.size() ; itri++ )
+        {
+            pths[itri].resize( 3 );
+            for ( int k = 0; k < 3; k++ )
+            {
+                vec3d p = ( pnt_vec[ 3 * itri + k ] - center ) * scale;
+                pths[itri][k] = ClipperLib::IntPoint( ToClipperInt( p.y() ), ToClipperInt( p.z() ) );
+            }
+
+            if ( !ClipperLib::Orientation( pths[itri] ) )
+            {
+                ClipperLib::ReversePath( pths[itri] );
+            }
+        }
+
+        ClipperLib::Paths solution;
+        TiledUnion( pths, solution, false );
+
+        double asum = 0;
+        for ( int i = 0; i < solution.size(); i++ )
+        {
+            asum += ClipperLib::Area( solution[i] );
+        }
+        area_vec[idir] = asum / ( scale * scale );
+    } );
+
+    //==== Create Results ====//
+    Results* res = ResultsMgr.CreateResults( "Projection_Batch" );
+
+    vector < vec3d > out_dir_vec = dir_vec;
+    res->Add( NameValData( "Direction", out_dir_vec ) );
+    res->Add( NameValData( "Area", area_vec ) );
+
+    return res;
+}
+
 bool TMeshCompare( TMesh* a, TMesh* b )
 {
     return ( a->m_PtrID < b->m_PtrID );
@@ -672,7 +803,7 @@ void ProjectionMgrSingleton::MeshToPaths( const vector < TMesh* > & tmv, Clipper
             for ( int k = 0; k < 3; k++ )
             {
                 vec3d p = tmv[i]->m_TVec[j]->GetTriNode( k )->m_Pnt;
-                pths[itri][k] = ClipperLib::IntPoint( (int) p.y(), (int) p.z() );
+                pths[itri][k] = ClipperLib::IntPoint( ToClipperInt( p.y() ), ToClipperInt( p.z() ) );
             }
 
             if ( !ClipperLib::Orientation( pths[itri] ) )
@@ -703,7 +834,7 @@ void ProjectionMgrSingleton::MeshToPathsVec( const vector < TMesh* > & tmv, vect
             for ( int k = 0; k < 3; k++ )
             {
                 vec3d p = tmv[i]->m_TVec[j]->GetTriNode( k )->m_Pnt;
-                pthvec[i][j][k] = ClipperLib::IntPoint( (int) p.v[keepdir1], (int) p.v[keepdir2] );
+                pthvec[i][j][k] = ClipperLib::IntPoint( ToClipperInt( p.v[keepdir1] ), ToClipperInt( p.v[keepdir2] ) );
             }
 
             if ( !ClipperLib::Orientation( pthvec[i][j] ) )
@@ -752,10 +883,24 @@ void ProjectionMgrSingleton::Poly3dToPoly2d( vector < vector < vec3d > > & invec
     }
 }
 
+//==== Clipper Units Per Model Unit ====//
+double ProjectionMgrSingleton::GetClipperScale( const BndBox & box )
+{
+    // Past loRange Clipper switches to slower 128 bit math, past hiRange it fails.
+    double range = std::min( std::max( m_ClipperRange, 1.0 ), 0.5 * ( double ) ClipperLib::hiRange );
+
+    double dist = box.GetLargestDist();
+    if ( dist <= 0.0 )
+    {
+        return 1.0;
+    }
+    return range / dist;
+}
+
 double ProjectionMgrSingleton::BuildToFromClipper( Matrix4d & toclip, Matrix4d & fromclip, bool translate_to_max )
 {
     vec3d center = m_BBox.GetCenter();
-    double scale = ClipperLib::loRange/m_BBox.GetLargestDist();
+    double scale = GetClipperScale( m_BBox );
 
     toclip.loadIdentity();
     toclip.scale( scale );
@@ -789,18 +934,112 @@ void ProjectionMgrSingleton::ClosePaths( ClipperLib::Paths & pths )
     }
 }
 
-void ProjectionMgrSingleton::Union( ClipperLib::Paths & pths, ClipperLib::Paths & sol )
+//==== Single Clipper Union, No Clean Up ====//
+static void ClipperUnion( const ClipperLib::Paths & pths, ClipperLib::Paths & sol )
 {
     ClipperLib::Clipper clpr;
     clpr.AddPaths( pths, ClipperLib::ptSubject, true );
 
-    int err_cnt = 0;
     if ( !clpr.Execute( ClipperLib::ctUnion, sol, ClipperLib::pftPositive, ClipperLib::pftPositive ) )
     {
-        err_cnt++;
         printf( "Clipper error\n" );
     }
+}
+
+void ProjectionMgrSingleton::Union( ClipperLib::Paths & pths, ClipperLib::Paths & sol )
+{
+    TiledUnion( pths, sol, true );
+}
+
+//==== Union Batches Of Nearby Paths, Then Merge The Partial Results Pairwise ====//
+// The batches and the merge tree only depend on the paths, so the result does
+// not depend on how the tasks are scheduled.
+void ProjectionMgrSingleton::TiledUnion( const ClipperLib::Paths & pths, ClipperLib::Paths & sol, bool parallel )
+{
+    int npth = ( int )pths.size();
+    int batch_size = std::max( m_UnionBatchSize, 1 );
+
+    sol.clear();
+
+    if ( npth <= batch_size )
+    {
+        ClipperUnion( pths, sol );
+        CleanPolygons( sol );
+        SimplifyPolygons( sol );
+        return;
+    }
+
+    //==== Order Paths Along A Morton Curve Through Their First Points ====//
+    ClipperLib::cInt xmin = pths[0][0].X, xmax = xmin;
+    ClipperLib::cInt ymin = pths[0][0].Y, ymax = ymin;
+    for ( int i = 0 ; i < npth ; i++ )
+    {
+        if ( pths[i].empty() )
+        {
+            continue;
+        }
+        xmin = std::min( xmin, pths[i][0].X );
+        xmax = std::max( xmax, pths[i][0].X );
+        ymin = std::min( ymin, pths[i][0].Y );
+        ymax = std::max( ymax, pths[i][0].Y );
+    }
+    double xfact = 65535.0 / std::max( ( double )( xmax - xmin ), 1.0 );
+    double yfact = 65535.0 / std::max( ( double )( ymax - ymin ), 1.0 );
+
+    vector < std::pair < uint32_t, int > > key_vec( npth );
+    for ( int i = 0 ; i < npth ; i++ )
+    {
+        uint32_t key = 0;
+        if ( !pths[i].empty() )
+        {
+            key = MortonKey( ( uint32_t )( ( double )( pths[i][0].X - xmin ) * xfact ),
+                             ( uint32_t )( ( double )( pths[i][0].Y - ymin ) * yfact ) );
+        }
+        key_vec[i] = std::make_pair( key, i );
+    }
+    std::sort( key_vec.begin(), key_vec.end() );
 
+    //==== Union Each Batch ====//
+    int nbatch = ( npth + batch_size - 1 ) / batch_size;
+    vector < ClipperLib::Paths > part_vec( nbatch );
+    RunTasks( nbatch, parallel, [&]( int b )
+    {
+        int start = b * batch_size;
+        int end = std::min( start + batch_size, npth );
+
+        ClipperLib::Paths batch;
+        batch.reserve( end - start );
+        for ( int i = start ; i < end ; i++ )
+        {
+            batch.push_back( pths[ key_vec[i].second ] );
+        }
+        ClipperUnion( batch, part_vec[b] );
+    } );
+
+    //==== Merge Neighboring Partial Results Until One Is Left ====//
+    while ( part_vec.size() > 1 )
+    {
+        int npart = ( int )part_vec.size();
+        vector < ClipperLib::Paths > next_vec( ( npart + 1 ) / 2 );
+        RunTasks( ( int )next_vec.size(), parallel, [&]( int k )
+        {
+            if ( 2 * k + 1 < npart )
+            {
+                ClipperLib::Paths both;
+                both.reserve( part_vec[2 * k].size() + part_vec[2 * k + 1].size() );
+                both.insert( both.end(), part_vec[2 * k].begin(), part_vec[2 * k].end() );
+                both.insert( both.end(), part_vec[2 * k + 1].begin(), part_vec[2 * k + 1].end() );
+                ClipperUnion( both, next_vec[k] );
+            }
+            else
+            {
+                next_vec[k].swap( part_vec[2 * k] );
+            }
+        } );
+        part_vec.swap( next_vec );
+    }
+
+    sol.swap( part_vec[0] );
     CleanPolygons( sol );
     SimplifyPolygons( sol );
 }
@@ -872,10 +1111,11 @@ void ProjectionMgrSingleton::Intersect( vector < ClipperLib::Paths > & pthsvecA,
 {
     solvec.resize( pthsvecA.size() );
 
-    for ( int i = 0; i < pthsvecA.size(); i++ )
+    //==== Each Component Is Clipped Independently ====//
+    ParallelFor( ( int )pthsvecA.size(), [&]( int i )
     {
         Intersect( pthsvecA[i], pthB, solvec[i] );
-    }
+    } );
 }
 
 void ProjectionMgrSingleton::Triangulate()
@@ -65,6 +65,10 @@ public:
     virtual Results* Project( const string &tgeom, int bset, const vec3d & dir );
     virtual Results* Project( const string &tgeom, string bgeom, const vec3d & dir );
 
+    //==== Projected Area Along Many Directions - Target Is Meshed Once ====//
+    virtual Results* ProjectAreas( int tset, const vector < vec3d > & dir_vec );
+    virtual Results* ProjectAreas( const string &tgeom, const vector < vec3d > & dir_vec );
+
     virtual string MakeMeshGeom();
 
     virtual void ExportProjectLines( vector < TMesh* > targetTMeshVec );
@@ -92,9 +96,21 @@ public:
 
     vector < bool > m_IsHole;
 
+    //==== Clipper Tuning - Also Projection Analysis Inputs ====//
+    void SetClipperRange( double range )            { m_ClipperRange = range; }
+    double GetClipperRange()                        { return m_ClipperRange; }
+    void SetUnionBatchSize( int batch_size )        { m_UnionBatchSize = batch_size; }
+    int GetUnionBatchSize()                         { return m_UnionBatchSize; }
+
 
 protected:
 
+    // Clipper integer coordinates span about this many units across the bounding box.
+    double m_ClipperRange;
+
+    // Paths unioned together in one Clipper call before partial results are merged.
+    int m_UnionBatchSize;
+
     virtual void CleanMesh( vector < TMesh* > & tmv );
 
     virtual void TransformMesh( vector < TMesh* > & tmv, const Matrix4d & mat );
@@ -113,11 +129,13 @@ protected:
 
     virtual void Poly3dToPoly2d( vector < vector < vec3d > > & invec, vector < vector < vec2d > > & outvec );
 
+    virtual double GetClipperScale( const BndBox & box );
     virtual double BuildToFromClipper( Matrix4d & toclip, Matrix4d & fromclip, bool translate_to_max = true );
 
     virtual void ClosePaths( ClipperLib::Paths & pths );
 
     virtual void Union( ClipperLib::Paths & pths, ClipperLib::Paths & sol );
+    virtual void TiledUnion( const ClipperLib::Paths & pths, ClipperLib::Paths & sol, bool parallel );
     virtual void Union( vector < ClipperLib::Paths > & pthsvec,  ClipperLib::Paths & sol );
     virtual void Union( vector < ClipperLib::Paths > & pthsvec, vector < ClipperLib::Paths > & solvec, vector < string > & ids );
 
@@ -135,6 +153,8 @@ protected:
     virtual Results* Project( vector < TMesh* > &targetTMeshVec, const vec3d & dir );
     virtual Results* Project( vector < TMesh* > &targetTMeshVec, vector < TMesh* > &boundaryTMeshVec, const vec3d & dir );
 
+    virtual Results* ProjectAreas( vector < TMesh* > &targetTMeshVec, const vector < vec3d > & dir_vec );
+
     BndBox m_BBox;
 
 private:
@@ -25,6 +25,10 @@ public:
 
     virtual void UpdateSurf();
     virtual void UpdateDrawObj();
+    virtual bool UsesPreTess()
+    {
+        return false;
+    }
     virtual void LoadDrawObjs(vector< DrawObj* > & draw_obj_vec);
     virtual string getFeedbackGroupName();
 
@@ -39,6 +39,61 @@ void MessageCallback( const asSMessageInfo *msg, void *param )
     printf( "%s", str );
 }
 
+//==== 64 Bit FNV-1a Hash, Continued From hash ====//
+static uint64_t HashBytes( const void* data, size_t num_bytes, uint64_t hash = 14695981039346656037ULL )
+{
+    const unsigned char* bytes = static_cast< const unsigned char* >( data );
+    for ( size_t i = 0 ; i < num_bytes ; i++ )
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static uint64_t HashString( const string & str, uint64_t hash )
+{
+    return HashBytes( str.c_str(), str.size() + 1, hash );
+}
+
+//==== Byte Code Stream Over A Memory Buffer ====//
+class ByteCodeStream : public asIBinaryStream
+{
+public:
+
+    ByteCodeStream()
+    {
+        m_ReadPos = 0;
+        m_ReadError = false;
+    }
+
+    void Read( void *ptr, asUINT size )
+    {
+        if ( m_ReadPos + size > m_Buffer.size() )
+        {
+            memset( ptr, 0, size );
+            m_ReadPos = m_Buffer.size();
+            m_ReadError = true;
+            return;
+        }
+        memcpy( ptr, &m_Buffer[m_ReadPos], size );
+        m_ReadPos += size;
+    }
+
+    void Write( const void *ptr, asUINT size )
+    {
+        const char* bytes = static_cast< const char* >( ptr );
+        m_Buffer.insert( m_Buffer.end(), bytes, bytes + size );
+    }
+
+    vector< char > m_Buffer;
+    size_t m_ReadPos;
+    bool m_ReadError;
+};
+
+static const char* BYTE_CODE_TAG = "VSPASBC2";
+static const size_t BYTE_CODE_TAG_LEN = 8;
+
 //==================================================================================================//
 //========================================= ScriptMgr      =========================================//
 //==================================================================================================//
@@ -47,7 +102,7 @@ void MessageCallback( const asSMessageInfo *msg, void *param )
 //==== Constructor ====//
 ScriptMgrSingleton::ScriptMgrSingleton()
 {
-
+    m_InterfaceHash = 0;
 }
 
 //==== Set Up Script Engine, Script Error Callbacks ====//
@@ -97,6 +152,34 @@ void ScriptMgrSingleton::Init( )
     RegisterAPI( m_ScriptEngine );
     RegisterUtility(  m_ScriptEngine );
 
+    //==== Byte Code Format Follows The Engine, Inlines Enum Values And Binds By Declaration - Key On All ====//
+    uint64_t hash = HashString( asGetLibraryVersion(), HashBytes( 0, 0 ) );
+    int ptr_size = ( int )sizeof( void* );
+    hash = HashBytes( &ptr_size, sizeof( ptr_size ), hash );
+    for ( asUINT i = 0 ; i < se->GetGlobalFunctionCount() ; i++ )
+    {
+        hash = HashString( se->GetGlobalFunctionByIndex( i )->GetDeclaration( true, true, false ), hash );
+    }
+    for ( asUINT i = 0 ; i < se->GetObjectTypeCount() ; i++ )
+    {
+        asITypeInfo* type = se->GetObjectTypeByIndex( i );
+        hash = HashString( type->GetName(), hash );
+        for ( asUINT j = 0 ; j < type->GetMethodCount() ; j++ )
+        {
+            hash = HashString( type->GetMethodByIndex( j )->GetDeclaration( true, true, false ), hash );
+        }
+    }
+    for ( asUINT i = 0 ; i < se->GetEnumCount() ; i++ )
+    {
+        asITypeInfo* type = se->GetEnumByIndex( i );
+        for ( asUINT j = 0 ; j < type->GetEnumValueCount() ; j++ )
+        {
+            int val;
+            hash = HashString( type->GetEnumValueByIndex( j, &val ), hash );
+            hash = HashBytes( &val, sizeof( val ), hash );
+        }
+    }
+    m_InterfaceHash = hash;
 
 }
 
@@ -185,15 +268,23 @@ string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, co
             return iter->first;
     }
 
-    //==== Start A New Module ====//
-    r = m_ScriptBuilder.StartNewModule( m_ScriptEngine, updated_module_name.c_str() );
-    if( r < 0 )        return string();
+    //==== Any Functions Resolved In An Old Module Of This Name Are Gone ====//
+    m_FunctionCacheMap.erase( updated_module_name );
+
+    //==== Start A New Module - Or Load One Compiled Earlier ====//
+    if ( !LoadByteCode( updated_module_name, script_content ) )
+    {
+        r = m_ScriptBuilder.StartNewModule( m_ScriptEngine, updated_module_name.c_str() );
+        if( r < 0 )        return string();
+
+        r = m_ScriptBuilder.AddSectionFromMemory( updated_module_name.c_str(), script_content.c_str(), script_content.size()  );
+        if ( r < 0 )    return string();
 
-    r = m_ScriptBuilder.AddSectionFromMemory( updated_module_name.c_str(), script_content.c_str(), script_content.size()  );
-    if ( r < 0 )    return string();
+        r = m_ScriptBuilder.BuildModule();
+        if ( r < 0 )    return string();
 
-    r = m_ScriptBuilder.BuildModule();
-    if ( r < 0 )    return string();
+        SaveByteCode( updated_module_name, script_content );
+    }
 
     //==== Add To Map ====//
     m_ModuleContentMap[ updated_module_name ] = script_content;
@@ -231,6 +322,7 @@ bool ScriptMgrSingleton::RemoveScript( const string &  module_name )
     }
 
     m_ModuleContentMap.erase( iter );
+    m_FunctionCacheMap.erase( module_name );
 
     int ret = m_ScriptEngine->DiscardModule( module_name.c_str() );
 
@@ -246,28 +338,24 @@ bool ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* f
     int r;
 
     // Find the function that is to be called.
-    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name );
-
-    if ( !mod )
-    {
-        printf( "Error ExecuteScript GetModule %s\n", module_name );
-        return false;
-    }
-
-    asIScriptFunction *func = mod->GetFunctionByDecl( function_name );
+    asIScriptFunction *func = FindFunction( module_name, function_name );
     if( func == 0 )
     {
         return false;
     }
 
-    // Create our context, prepare it, and then execute
-    asIScriptContext *ctx = m_ScriptEngine->CreateContext();
+    // Take a context from the engine's pool, prepare it, and then execute.
+    // Scripts may call back into code that runs other scripts, so each call
+    // takes its own context.
+    asIScriptContext *ctx = m_ScriptEngine->RequestContext();
     ctx->Prepare( func );
     if ( arg_flag )
     {
         ctx->SetArgDouble( 0, arg );
     }
     r = ctx->Execute();
+
+    bool success = true;
     if( r != asEXECUTION_FINISHED )
     {
         // The execution didn't complete as expected. Determine what happened.
@@ -276,11 +364,154 @@ bool ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* f
             // An exception occurred, let the script writer know what happened so it can be corrected.
             printf( "An exception '%s' occurred \n", ctx->GetExceptionString() );
         }
+        success = false;
+    }
+
+    m_ScriptEngine->ReturnContext( ctx );
+    return success;
+}
+
+//==== Find Function In Module, Resolving Each Declaration Only Once ====//
+asIScriptFunction* ScriptMgrSingleton::FindFunction( const string & module_name, const string & function_name )
+{
+    map< string, map< string, asIScriptFunction* > >::iterator mod_iter = m_FunctionCacheMap.find( module_name );
+    if ( mod_iter != m_FunctionCacheMap.end() )
+    {
+        map< string, asIScriptFunction* >::iterator func_iter = mod_iter->second.find( function_name );
+        if ( func_iter != mod_iter->second.end() )
+        {
+            return func_iter->second;
+        }
+    }
+
+    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name.c_str() );
+    if ( !mod )
+    {
+        printf( "Error ExecuteScript GetModule %s\n", module_name.c_str() );
+        return NULL;
+    }
+
+    asIScriptFunction *func = mod->GetFunctionByDecl( function_name.c_str() );
+    m_FunctionCacheMap[ module_name ][ function_name ] = func;
+    return func;
+}
+
+//==== Cache File For Script Content - Empty If Not Cacheable ====//
+string ScriptMgrSingleton::ByteCodeFileName( const string & script_content, uint64_t & key )
+{
+    //==== Engine Version, Registered API And Source ====//
+    key = HashString( script_content, m_InterfaceHash );
+
+    //==== Included Files Are Not Part Of The Content, So Could Change Unseen ====//
+    if ( m_ByteCodeCacheDir.empty() || script_content.find( "#include" ) != string::npos )
+    {
+        return string();
+    }
+
+    char str[64];
+    sprintf( str, "/%016llx.asbc", ( unsigned long long )key );
+    return m_ByteCodeCacheDir + str;
+}
+
+//==== Load Module From The Byte Code Cache ====//
+bool ScriptMgrSingleton::LoadByteCode( const string & module_name, const string & script_content )
+{
+    uint64_t key;
+    string file_name = ByteCodeFileName( script_content, key );
+    if ( file_name.empty() )
+    {
+        return false;
+    }
+
+    FILE* fp = fopen( file_name.c_str(), "rb" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    ByteCodeStream stream;
+    char buff[4096];
+    size_t num_read;
+    while ( ( num_read = fread( buff, 1, sizeof( buff ), fp ) ) > 0 )
+    {
+        stream.Write( buff, ( asUINT )num_read );
+    }
+    fclose( fp );
+
+    //==== Tag, Key And Checksum - Skip Partly Written, Renamed Or Foreign Files ====//
+    size_t head_len = BYTE_CODE_TAG_LEN + 2 * sizeof( uint64_t );
+    if ( stream.m_Buffer.size() <= head_len || memcmp( &stream.m_Buffer[0], BYTE_CODE_TAG, BYTE_CODE_TAG_LEN ) != 0 )
+    {
+        return false;
+    }
+
+    uint64_t file_key, check_sum;
+    memcpy( &file_key, &stream.m_Buffer[BYTE_CODE_TAG_LEN], sizeof( file_key ) );
+    memcpy( &check_sum, &stream.m_Buffer[BYTE_CODE_TAG_LEN + sizeof( file_key )], sizeof( check_sum ) );
+    if ( file_key != key || check_sum != HashBytes( &stream.m_Buffer[head_len], stream.m_Buffer.size() - head_len ) )
+    {
+        return false;
+    }
+    stream.m_ReadPos = head_len;
+
+    asIScriptModule* mod = m_ScriptEngine->GetModule( module_name.c_str(), asGM_ALWAYS_CREATE );
+    if ( !mod )
+    {
+        return false;
+    }
+
+    //==== A Stale Entry Is Not A Script Error - Keep Its Messages Out ====//
+    string messages = m_ScriptMessages;
+    if ( mod->LoadByteCode( &stream ) < 0 || stream.m_ReadError )
+    {
+        m_ScriptEngine->DiscardModule( module_name.c_str() );
+        m_ScriptMessages = messages;
         return false;
     }
     return true;
 }
 
+//==== Store Freshly Built Module In The Byte Code Cache ====//
+void ScriptMgrSingleton::SaveByteCode( const string & module_name, const string & script_content )
+{
+    uint64_t key;
+    string file_name = ByteCodeFileName( script_content, key );
+    if ( file_name.empty() )
+    {
+        return;
+    }
+
+    asIScriptModule* mod = m_ScriptEngine->GetModule( module_name.c_str() );
+    if ( !mod )
+    {
+        return;
+    }
+
+    ByteCodeStream stream;
+    if ( mod->SaveByteCode( &stream ) < 0 || stream.m_Buffer.empty() )
+    {
+        return;
+    }
+
+    if ( !MakeDir( m_ByteCodeCacheDir ) )
+    {
+        return;
+    }
+
+    FILE* fp = fopen( file_name.c_str(), "wb" );
+    if ( !fp )
+    {
+        return;
+    }
+
+    uint64_t check_sum = HashBytes( &stream.m_Buffer[0], stream.m_Buffer.size() );
+    fwrite( BYTE_CODE_TAG, 1, BYTE_CODE_TAG_LEN, fp );
+    fwrite( &key, sizeof( key ), 1, fp );
+    fwrite( &check_sum, sizeof( check_sum ), 1, fp );
+    fwrite( &stream.m_Buffer[0], 1, stream.m_Buffer.size(), fp );
+    fclose( fp );
+}
+
 //==== Return Script Content Given Module Name ====//
 string ScriptMgrSingleton::FindModuleContent( const string &  module_name )
 {
@@ -1674,6 +1905,12 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     r = se->RegisterGlobalFunction( "double SetParmValUpdate(const string & in geom_id, const string & in parm_name, const string & in parm_group_name, double val )",
                                     asFUNCTIONPR( vsp::SetParmValUpdate, ( const string &, const string &, const string &, double val ), double ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void BeginParmBatch()", asFUNCTION( vsp::BeginParmBatch ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void CommitParmBatch()", asFUNCTION( vsp::CommitParmBatch ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "array<double>@  SetParmVals( array<string>@ parm_arr, array<double>@ val_arr )", asMETHOD( ScriptMgrSingleton, SetParmVals ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr );
+    assert( r >= 0 );
     r = se->RegisterGlobalFunction( "double GetParmVal(const string & in parm_id )", asFUNCTIONPR( vsp::GetParmVal, ( const string & ), double ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "double GetParmVal(const string & in geom_id, const string & in name, const string & in group )",
@@ -2088,6 +2325,26 @@ void ScriptMgrSingleton::SetAirfoilPnts( const string& xsec_id, CScriptArray* up
     vsp::SetAirfoilPnts( xsec_id, up_pnt_vec, low_pnt_vec );
 }
 
+CScriptArray* ScriptMgrSingleton::SetParmVals( CScriptArray* parm_arr, CScriptArray* val_arr )
+{
+    vector < string > parm_vec;
+    parm_vec.resize( parm_arr->GetSize() );
+    for ( int i = 0 ; i < ( int )parm_arr->GetSize() ; i++ )
+    {
+        parm_vec[i] = * ( string* )( parm_arr->At( i ) );
+    }
+
+    vector < double > val_vec;
+    val_vec.resize( val_arr->GetSize() );
+    for ( int i = 0 ; i < ( int )val_arr->GetSize() ; i++ )
+    {
+        val_vec[i] = * ( double* )( val_arr->At( i ) );
+    }
+
+    m_ProxyDoubleArray = vsp::SetParmVals( parm_vec, val_vec );
+    return GetProxyDoubleArray();
+}
+
 void ScriptMgrSingleton::SetUpperCST( const string& xsec_id, int deg, CScriptArray* coefs_arr )
 {
     vector < double > coefs_vec;
@@ -24,6 +24,7 @@
 #include "XmlUtil.h"
 
 #include <assert.h>
+#include <stdint.h>
 #include <string>
 #include <vector>
 #include <map>
@@ -59,6 +60,12 @@ public:
 
     bool ExecuteScript(  const char* module_name,  const char* function_name, bool arg_flag = false, double arg = 0.0 );
 
+    //==== Compiled Modules Cached On Disk - Off Unless A Dir Is Set, e.g. vsp -scriptcache <dir> ====//
+    // Files are <dir>/<key>.asbc, keyed on the AngelScript version, the registered API and the
+    // script source. Entries are never evicted, delete the dir to clear it. Empty dir turns it off.
+    void SetByteCodeCacheDir( const string & dir )          { m_ByteCodeCacheDir = dir; }
+    string GetByteCodeCacheDir()                            { return m_ByteCodeCacheDir; }
+
     void AddToMessages( const string & msg )                { m_ScriptMessages += msg; }
     void ClearMessages()                                    { m_ScriptMessages.clear(); }
     string GetMessages()                                    { return m_ScriptMessages; }   
@@ -111,6 +118,12 @@ private:
     void RegisterAPI( asIScriptEngine* se );
     void RegisterUtility( asIScriptEngine* se );
 
+    asIScriptFunction* FindFunction( const string & module_name, const string & function_name );
+
+    string ByteCodeFileName( const string & script_content, uint64_t & key );
+    bool LoadByteCode( const string & module_name, const string & script_content );
+    void SaveByteCode( const string & module_name, const string & script_content );
+
     //==== Member Variables ====//
     asIScriptEngine* m_ScriptEngine;
 //    map< string, CScriptBuilder > m_BuilderMap;
@@ -118,6 +131,12 @@ private:
     map< string, string > m_ModuleContentMap;
     string m_ScriptMessages;
 
+    //==== Resolved Functions By Module And Declaration - NULL When Not Defined ====//
+    map< string, map< string, asIScriptFunction* > > m_FunctionCacheMap;
+
+    string m_ByteCodeCacheDir;
+    uint64_t m_InterfaceHash;               // Registered API - Part Of The Byte Code Cache Key
+
     //==== Test Proxy Stuff ====//
     int m_SaveInt;
     vector< vec3d > m_ProxyVec3dArray;
@@ -158,6 +177,8 @@ private:
 
     void DeleteGeomVec( CScriptArray* del_arr );
 
+    CScriptArray* SetParmVals( CScriptArray* parm_arr, CScriptArray* val_arr );
+
     void SetXSecPnts( const string& xsec_id, CScriptArray* pnt_arr );
     void SetAirfoilPnts( const string& xsec_id, CScriptArray* up_pnt_arr, CScriptArray* low_pnt_arr );
     void SetVec3dArray( CScriptArray* arr );
@@ -25,6 +25,10 @@
 #include "Geom.h"
 #include "SubSurfaceMgr.h"
 #include "PntNodeMerge.h"
+#include "ParallelUtil.h"
+
+#include <cstring>
+#include <stdint.h>
 
 
 //===============================================//
@@ -153,6 +157,33 @@ TMesh* TEdge::GetParTMesh()
     return GetParTri()->GetTMeshPtr();
 }
 
+//==== Inertia Of A Tetra With One Vertex At The Origin Or A Tri About Its Centroid ====//
+//==== Ixx, Iyy, Izz, Ixy, Ixz, Iyz ====//
+static void ThreeVecInertia( double mass, const vec3d & a, const vec3d & b, const vec3d & c, double inertia[6] )
+{
+    double Ix = mass / 10.0 * ( a.x() * a.x() + b.x() * b.x() + c.x() * c.x() +
+                                a.x() * b.x() + a.x() * c.x() + b.x() * c.x() );
+
+    double Iy = mass / 10.0 * ( a.y() * a.y() + b.y() * b.y() + c.y() * c.y() +
+                                a.y() * b.y() + a.y() * c.y() + b.y() * c.y() );
+
+    double Iz = mass / 10.0 * ( a.z() * a.z() + b.z() * b.z() + c.z() * c.z() +
+                                a.z() * b.z() + a.z() * c.z() + b.z() * c.z() );
+
+    inertia[0] = Iy + Iz;
+    inertia[1] = Ix + Iz;
+    inertia[2] = Ix + Iy;
+
+    inertia[3] = mass / 20.0 * ( 2.0 * ( a.x() * a.y() + b.x() * b.y() + c.x() * c.y() ) +
+                                 a.x() * b.y() + b.x() * a.y() + a.x() * c.y() + c.x() * a.y() + b.x() * c.y() + c.x() * b.y() );
+
+    inertia[4] = mass / 20.0 * ( 2.0 * ( a.x() * a.z() + b.x() * b.z() + c.x() * c.z() ) +
+                                 a.x() * b.z() + b.x() * a.z() + a.x() * c.z() + c.x() * a.z() + b.x() * c.z() + c.x() * b.z() );
+
+    inertia[5] = mass / 20.0 * ( 2.0 * ( a.y() * a.z() + b.y() * b.z() + c.y() * c.z() ) +
+                                 a.y() * b.z() + b.y() * a.z() + a.y() * c.z() + c.y() * a.z() + b.y() * c.z() + c.y() * b.z() );
+}
+
 //=======================================================================//
 //=======================================================================//
 //=======================================================================//
@@ -172,28 +203,14 @@ TetraMassProp::TetraMassProp( string id, double denIn, vec3d& p0, vec3d& p1, vec
     m_Vol  = tetra_volume( m_v1, m_v2, m_v3 );
     m_Mass = m_Density * std::abs( m_Vol );
 
-    double Ix = m_Mass / 10.0 * ( m_v1.x() * m_v1.x() + m_v2.x() * m_v2.x() + m_v3.x() * m_v3.x() +
-                                  m_v1.x() * m_v2.x() + m_v1.x() * m_v3.x() + m_v2.x() * m_v3.x() );
-
-    double Iy = m_Mass / 10.0 * ( m_v1.y() * m_v1.y() + m_v2.y() * m_v2.y() + m_v3.y() * m_v3.y() +
-                                  m_v1.y() * m_v2.y() + m_v1.y() * m_v3.y() + m_v2.y() * m_v3.y() );
-
-    double Iz = m_Mass / 10.0 * ( m_v1.z() * m_v1.z() + m_v2.z() * m_v2.z() + m_v3.z() * m_v3.z() +
-                                  m_v1.z() * m_v2.z() + m_v1.z() * m_v3.z() + m_v2.z() * m_v3.z() );
-
-    m_Ixx = Iy + Iz;
-    m_Iyy = Ix + Iz;
-    m_Izz = Ix + Iy;
-
-    m_Ixy = m_Mass / 20.0 * ( 2.0 * ( m_v1.x() * m_v1.y() + m_v2.x() * m_v2.y() + m_v3.x() * m_v3.y() ) +
-                              m_v1.x() * m_v2.y() + m_v2.x() * m_v1.y() + m_v1.x() * m_v3.y() + m_v3.x() * m_v1.y() + m_v2.x() * m_v3.y() + m_v3.x() * m_v2.y() );
-
-    m_Iyz = m_Mass / 20.0 * ( 2.0 * ( m_v1.y() * m_v1.z() + m_v2.y() * m_v2.z() + m_v3.y() * m_v3.z() ) +
-                              m_v1.y() * m_v2.z() + m_v2.y() * m_v1.z() + m_v1.y() * m_v3.z() + m_v3.y() * m_v1.z() + m_v2.y() * m_v3.z() + m_v3.y() * m_v2.z() );
-
-    m_Ixz = m_Mass / 20.0 * ( 2.0 * ( m_v1.x() * m_v1.z() + m_v2.x() * m_v2.z() + m_v3.x() * m_v3.z() ) +
-                              m_v1.x() * m_v2.z() + m_v2.x() * m_v1.z() + m_v1.x() * m_v3.z() + m_v3.x() * m_v1.z() + m_v2.x() * m_v3.z() + m_v3.x() * m_v2.z() );
-
+    double inertia[6];
+    ThreeVecInertia( m_Mass, m_v1, m_v2, m_v3, inertia );
+    m_Ixx = inertia[0];
+    m_Iyy = inertia[1];
+    m_Izz = inertia[2];
+    m_Ixy = inertia[3];
+    m_Ixz = inertia[4];
+    m_Iyz = inertia[5];
 }
 
 
@@ -241,29 +258,151 @@ TriShellMassProp::TriShellMassProp( string id, double mass_area_in, vec3d& p0, v
 
     m_Mass = m_TriArea * m_MassArea;
 
-    double Ix = m_Mass / 10.0 * ( m_v0.x() * m_v0.x() + m_v1.x() * m_v1.x() + m_v2.x() * m_v2.x() +
-                                  m_v0.x() * m_v1.x() + m_v0.x() * m_v2.x() + m_v1.x() * m_v2.x() );
+    double inertia[6];
+    ThreeVecInertia( m_Mass, m_v0, m_v1, m_v2, inertia );
+    m_Ixx = inertia[0];
+    m_Iyy = inertia[1];
+    m_Izz = inertia[2];
+    m_Ixy = inertia[3];
+    m_Ixz = inertia[4];
+    m_Iyz = inertia[5];
+}
+
+//=======================================================================//
+//=======================================================================//
+//=======================================================================//
+MassPropSum::MassPropSum()
+{
+    for ( int i = 0 ; i < NUM_TERMS ; i++ )
+    {
+        m_Sum[i] = m_Comp[i] = 0.0;
+    }
+}
+
+MassPropSum::MassPropSum( const vec3d & ref )
+{
+    m_Ref = ref;
+    for ( int i = 0 ; i < NUM_TERMS ; i++ )
+    {
+        m_Sum[i] = m_Comp[i] = 0.0;
+    }
+}
+
+//==== Same Terms As TetraMassProp ====//
+void MassPropSum::AddTetra( double den, const vec3d& p0, const vec3d& p1, const vec3d& p2, const vec3d& p3 )
+{
+    vec3d v1 = p1 - p0;
+    vec3d v2 = p2 - p0;
+    vec3d v3 = p3 - p0;
+
+    vec3d cg = ( v1 + v2 + v3 ) * 0.25 + p0;
 
-    double Iy = m_Mass / 10.0 * ( m_v0.y() * m_v0.y() + m_v1.y() * m_v1.y() + m_v2.y() * m_v2.y() +
-                                  m_v0.y() * m_v1.y() + m_v0.y() * m_v2.y() + m_v1.y() * m_v2.y() );
+    double vol = std::abs( tetra_volume( v1, v2, v3 ) );
+    double mass = den * vol;
 
-    double Iz = m_Mass / 10.0 * ( m_v0.z() * m_v0.z() + m_v1.z() * m_v1.z() + m_v2.z() * m_v2.z() +
-                                  m_v0.z() * m_v1.z() + m_v0.z() * m_v2.z() + m_v1.z() * m_v2.z() );
+    double inertia[6];
+    ThreeVecInertia( mass, v1, v2, v3, inertia );
 
-    m_Ixx = Iy + Iz;
-    m_Iyy = Ix + Iz;
-    m_Izz = Ix + Iy;
+    AddElement( vol, mass, cg, inertia );
+}
+
+//==== Same Terms As TriShellMassProp ====//
+void MassPropSum::AddTriShell( double mass_area, const vec3d& p0, const vec3d& p1, const vec3d& p2 )
+{
+    vec3d cg = ( p0 + p1 + p2 ) * ( 1.0 / 3.0 );
+
+    vec3d v0 = p0 - cg;
+    vec3d v1 = p1 - cg;
+    vec3d v2 = p2 - cg;
+
+    double mass = area( v0, v1, v2 ) * mass_area;
+
+    double inertia[6];
+    ThreeVecInertia( mass, v0, v1, v2, inertia );
+
+    AddElement( 0.0, mass, cg, inertia );
+}
+
+void MassPropSum::AddPointMass( double mass, const vec3d& pos )
+{
+    double inertia[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    AddElement( 0.0, mass, pos, inertia );
+}
+
+void MassPropSum::AddElement( double vol, double mass, const vec3d & cg, const double inertia[6] )
+{
+    vec3d d = cg - m_Ref;
+
+    AddTerm( VOL, vol );
+    AddTerm( MASS, mass );
+
+    AddTerm( MX, mass * d.x() );
+    AddTerm( MY, mass * d.y() );
+    AddTerm( MZ, mass * d.z() );
+
+    AddTerm( MXX, mass * d.x() * d.x() );
+    AddTerm( MYY, mass * d.y() * d.y() );
+    AddTerm( MZZ, mass * d.z() * d.z() );
+    AddTerm( MXY, mass * d.x() * d.y() );
+    AddTerm( MXZ, mass * d.x() * d.z() );
+    AddTerm( MYZ, mass * d.y() * d.z() );
+
+    for ( int i = 0 ; i < 6 ; i++ )
+    {
+        AddTerm( IXX + i, inertia[i] );
+    }
+}
+
+void MassPropSum::Add( const MassPropSum & sum )
+{
+    for ( int i = 0 ; i < NUM_TERMS ; i++ )
+    {
+        AddTerm( i, sum.m_Sum[i] );
+        AddTerm( i, -sum.m_Comp[i] );
+    }
+}
+
+double MassPropSum::GetVol() const
+{
+    return GetTerm( VOL );
+}
 
-    m_Ixy = m_Mass / 20.0 * ( 2.0 * ( m_v0.x() * m_v0.y() + m_v1.x() * m_v1.y() + m_v2.x() * m_v2.y() ) +
-                              m_v0.x() * m_v1.y() + m_v1.x() * m_v0.y() + m_v0.x() * m_v2.y() + m_v2.x() * m_v0.y() + m_v1.x() * m_v2.y() + m_v2.x() * m_v1.y() );
+double MassPropSum::GetMass() const
+{
+    return GetTerm( MASS );
+}
+
+vec3d MassPropSum::GetCG() const
+{
+    double mass = GetTerm( MASS );
+    if ( !mass )
+    {
+        return vec3d( 0, 0, 0 );
+    }
+    return m_Ref + vec3d( GetTerm( MX ), GetTerm( MY ), GetTerm( MZ ) ) * ( 1.0 / mass );
+}
 
-    m_Iyz = m_Mass / 20.0 * ( 2.0 * ( m_v0.y() * m_v0.z() + m_v1.y() * m_v1.z() + m_v2.y() * m_v2.z() ) +
-                              m_v0.y() * m_v1.z() + m_v1.y() * m_v0.z() + m_v0.y() * m_v2.z() + m_v2.y() * m_v0.z() + m_v1.y() * m_v2.z() + m_v2.y() * m_v1.z() );
+//==== Parallel Axis Shift Of Every Element To The Combined CG ====//
+void MassPropSum::GetInertia( double & ixx, double & iyy, double & izz, double & ixy, double & ixz, double & iyz ) const
+{
+    double mass = GetTerm( MASS );
+    vec3d d;
+    if ( mass )
+    {
+        d = vec3d( GetTerm( MX ), GetTerm( MY ), GetTerm( MZ ) ) * ( 1.0 / mass );
+    }
 
-    m_Ixz = m_Mass / 20.0 * ( 2.0 * ( m_v0.x() * m_v0.z() + m_v1.x() * m_v1.z() + m_v2.x() * m_v2.z() ) +
-                              m_v0.x() * m_v1.z() + m_v1.x() * m_v0.z() + m_v0.x() * m_v2.z() + m_v2.x() * m_v0.z() + m_v1.x() * m_v2.z() + m_v2.x() * m_v1.z() );
+    double mxx = GetTerm( MXX ) - mass * d.x() * d.x();
+    double myy = GetTerm( MYY ) - mass * d.y() * d.y();
+    double mzz = GetTerm( MZZ ) - mass * d.z() * d.z();
 
+    ixx = GetTerm( IXX ) + myy + mzz;
+    iyy = GetTerm( IYY ) + mxx + mzz;
+    izz = GetTerm( IZZ ) + mxx + myy;
 
+    ixy = GetTerm( IXY ) + GetTerm( MXY ) - mass * d.x() * d.y();
+    ixz = GetTerm( IXZ ) + GetTerm( MXZ ) - mass * d.x() * d.z();
+    iyz = GetTerm( IYZ ) + GetTerm( MYZ ) - mass * d.y() * d.z();
 }
 
 //===========================================================================================================//
@@ -476,11 +615,18 @@ void TMesh::CopyAttributes( TMesh* m )
     m_AreaCenter = m->m_AreaCenter;
 }
 
-xmlNodePtr TMesh::EncodeXml( xmlNodePtr & node )
+xmlNodePtr TMesh::EncodeXml( xmlNodePtr & node, bool binary_flag )
 {
     xmlNodePtr tmesh_node = xmlNewChild( node, NULL, BAD_CAST "TMesh", NULL );
     XmlUtil::AddIntNode( tmesh_node, "Num_Tris", ( int )m_TVec.size() );
-    EncodeTriList( tmesh_node );
+    if ( binary_flag )
+    {
+        EncodeIndexedMesh( tmesh_node );
+    }
+    else
+    {
+        EncodeTriList( tmesh_node );
+    }
     return tmesh_node;
 }
 
@@ -502,6 +648,11 @@ xmlNodePtr TMesh::EncodeTriList( xmlNodePtr & node )
 
 void TMesh::DecodeXml( xmlNodePtr & node )
 {
+    if ( DecodeIndexedMesh( node ) )
+    {
+        return;
+    }
+
     xmlNodePtr tri_list_node = XmlUtil::GetNode( node, "Tri_List", 0 );
     if ( tri_list_node )
     {
@@ -560,6 +711,142 @@ void TMesh::DecodeTriList( xmlNodePtr & node, int num_tris )
     }
 }
 
+xmlNodePtr TMesh::EncodeIndexedMesh( xmlNodePtr & node )
+{
+    int num_corners = 3 * ( int )m_TVec.size();
+
+    vector< vec3d > corner_vec( num_corners );
+    vector< double > norm_vec( num_corners );
+    for ( int i = 0 ; i < ( int )m_TVec.size() ; i++ )
+    {
+        corner_vec[ 3 * i ] = m_TVec[i]->m_N0->m_Pnt;
+        corner_vec[ 3 * i + 1 ] = m_TVec[i]->m_N1->m_Pnt;
+        corner_vec[ 3 * i + 2 ] = m_TVec[i]->m_N2->m_Pnt;
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            norm_vec[ 3 * i + k ] = m_TVec[i]->m_Norm[k];
+        }
+    }
+
+    //==== Group Corners With Bit Identical Points - Keeps -0.0 And NaN Exact And The Sort Well Ordered ====//
+    vector< uint64_t > bits_vec( 3 * num_corners );
+    for ( int i = 0 ; i < num_corners ; i++ )
+    {
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            double v = corner_vec[i][k];
+            memcpy( &bits_vec[ 3 * i + k ], &v, sizeof( v ) );
+        }
+    }
+
+    vector< int > order( num_corners );
+    for ( int i = 0 ; i < num_corners ; i++ )
+    {
+        order[i] = i;
+    }
+    std::sort( order.begin(), order.end(), [&]( int a, int b )
+    {
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            if ( bits_vec[ 3 * a + k ] != bits_vec[ 3 * b + k ] )
+            {
+                return bits_vec[ 3 * a + k ] < bits_vec[ 3 * b + k ];
+            }
+        }
+        return a < b;
+    } );
+
+    vector< int > group_vec( num_corners );
+    int num_groups = 0;
+    for ( int i = 0 ; i < num_corners ; i++ )
+    {
+        if ( i > 0 )
+        {
+            const uint64_t* p = &bits_vec[ 3 * order[i] ];
+            const uint64_t* q = &bits_vec[ 3 * order[i - 1] ];
+            if ( p[0] != q[0] || p[1] != q[1] || p[2] != q[2] )
+            {
+                num_groups++;
+            }
+        }
+        group_vec[ order[i] ] = num_groups;
+    }
+
+    //==== Number Nodes In Order Of First Use To Keep Tri Order Locality ====//
+    vector< int > node_id_vec( num_corners > 0 ? num_groups + 1 : 0, -1 );
+    vector< int > tri_ind_vec( num_corners );
+    vector< double > pnt_vec;
+    pnt_vec.reserve( 3 * node_id_vec.size() );
+    for ( int i = 0 ; i < num_corners ; i++ )
+    {
+        int & id = node_id_vec[ group_vec[i] ];
+        if ( id < 0 )
+        {
+            id = ( int )pnt_vec.size() / 3;
+            pnt_vec.push_back( corner_vec[i][0] );
+            pnt_vec.push_back( corner_vec[i][1] );
+            pnt_vec.push_back( corner_vec[i][2] );
+        }
+        tri_ind_vec[i] = id;
+    }
+
+    xmlNodePtr mesh_node = xmlNewChild( node, NULL, BAD_CAST "Indexed_Mesh", NULL );
+    XmlUtil::AddIntNode( mesh_node, "Num_Nodes", ( int )pnt_vec.size() / 3 );
+    XmlUtil::AddBinaryDoubleNode( mesh_node, "Nodes", pnt_vec );
+    XmlUtil::AddBinaryIntNode( mesh_node, "Tris", tri_ind_vec );
+    XmlUtil::AddBinaryDoubleNode( mesh_node, "Norms", norm_vec );
+    return mesh_node;
+}
+
+bool TMesh::DecodeIndexedMesh( xmlNodePtr & node )
+{
+    xmlNodePtr mesh_node = XmlUtil::GetNode( node, "Indexed_Mesh", 0 );
+    if ( !mesh_node )
+    {
+        return false;
+    }
+
+    vector< double > pnt_vec;
+    vector< int > tri_ind_vec;
+    vector< double > norm_vec;
+    if ( !XmlUtil::ExtractBinaryDoubleNode( mesh_node, "Nodes", pnt_vec ) ||
+         !XmlUtil::ExtractBinaryIntNode( mesh_node, "Tris", tri_ind_vec ) ||
+         !XmlUtil::ExtractBinaryDoubleNode( mesh_node, "Norms", norm_vec ) ||
+         pnt_vec.size() % 3 || tri_ind_vec.size() % 3 || norm_vec.size() != tri_ind_vec.size() )
+    {
+        printf( "Error: Bad Indexed_Mesh in TMesh\n" );
+        return true;
+    }
+
+    int num_nodes = ( int )pnt_vec.size() / 3;
+    for ( int i = 0 ; i < ( int )tri_ind_vec.size() ; i++ )
+    {
+        if ( tri_ind_vec[i] < 0 || tri_ind_vec[i] >= num_nodes )
+        {
+            printf( "Error: Bad Indexed_Mesh in TMesh\n" );
+            return true;
+        }
+    }
+
+    m_NVec.resize( num_nodes );
+    for ( int i = 0 ; i < num_nodes ; i++ )
+    {
+        m_NVec[i] = new TNode();
+        m_NVec[i]->m_Pnt = vec3d( pnt_vec[ 3 * i ], pnt_vec[ 3 * i + 1 ], pnt_vec[ 3 * i + 2 ] );
+    }
+
+    m_TVec.resize( tri_ind_vec.size() / 3 );
+    for ( int i = 0 ; i < ( int )m_TVec.size() ; i++ )
+    {
+        m_TVec[i] = new TTri();
+        m_TVec[i]->m_N0 = m_NVec[ tri_ind_vec[ 3 * i ] ];
+        m_TVec[i]->m_N1 = m_NVec[ tri_ind_vec[ 3 * i + 1 ] ];
+        m_TVec[i]->m_N2 = m_NVec[ tri_ind_vec[ 3 * i + 2 ] ];
+        m_TVec[i]->m_Norm = vec3d( norm_vec[ 3 * i ], norm_vec[ 3 * i + 1 ], norm_vec[ 3 * i + 2 ] );
+    }
+    return true;
+}
+
 void TMesh::LoadGeomAttributes( Geom* geomPtr )
 {
     /*color       = geomPtr->getColor();
@@ -733,6 +1020,36 @@ void TMesh::Intersect( TMesh* tm, bool UWFlag )
     m_TBox.Intersect( &tm->m_TBox, UWFlag );
 }
 
+//==== Find Intersection Segments Without Changing Either Mesh (Safe To Run In Parallel) ====//
+void TMesh::FindIntersections( TMesh* tm, vector< TISect > & isectVec )
+{
+    m_TBox.FindIntersections( &tm->m_TBox, isectVec );
+}
+
+//==== Add Intersection Edges To Both Tris, In The Order They Were Found ====//
+void TMesh::AddISectEdges( const vector< TISect > & isectVec )
+{
+    for ( int i = 0 ; i < ( int )isectVec.size() ; i++ )
+    {
+        const TISect & isect = isectVec[i];
+
+        TEdge* ie0 = new TEdge();
+        ie0->m_N0 = new TNode();
+        ie0->m_N0->m_Pnt = isect.m_E0;
+        ie0->m_N1 = new TNode();
+        ie0->m_N1->m_Pnt = isect.m_E1;
+
+        TEdge* ie1 = new TEdge();
+        ie1->m_N0 = new TNode();
+        ie1->m_N0->m_Pnt = isect.m_E0;
+        ie1->m_N1 = new TNode();
+        ie1->m_N1->m_Pnt = isect.m_E1;
+
+        isect.m_Tri0->m_ISectEdgeVec.push_back( ie0 );
+        isect.m_Tri1->m_ISectEdgeVec.push_back( ie1 );
+    }
+}
+
 bool TMesh::CheckIntersect( TMesh* tm )
 {
     return m_TBox.CheckIntersect( &tm->m_TBox );
@@ -755,6 +1072,10 @@ void TMesh::Split()
 
 void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
 {
+    //==== Collect Tris To Test - Each Only Sets Its Own Flag So Ray Casts Can Run In Parallel ====//
+    vector< TTri* > testVec;
+    testVec.reserve( m_TVec.size() );
+
     for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
         TTri* tri = m_TVec[t];
@@ -765,14 +1086,19 @@ void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
             tri->m_InteriorFlag = 1;
             for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
             {
-                DeterIntExtTri( tri->m_SplitVec[s], meshVec );
+                testVec.push_back( tri->m_SplitVec[s] );
             }
         }
         else
         {
-            DeterIntExtTri( tri, meshVec );
+            testVec.push_back( tri );
         }
     }
+
+    ParallelFor( ( int )testVec.size(), [&]( int i )
+    {
+        DeterIntExtTri( testVec[i], meshVec );
+    } );
 }
 
 void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
@@ -800,6 +1126,7 @@ void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
 
 void TMesh::MassDeterIntExt( vector< TMesh* >& meshVec )
 {
+    vector< TTri* > testVec;
     for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
         TTri* tri = m_TVec[t];
@@ -810,14 +1137,19 @@ void TMesh::MassDeterIntExt( vector< TMesh* >& meshVec )
             tri->m_InteriorFlag = 1;
             for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
             {
-                MassDeterIntExtTri( tri->m_SplitVec[s], meshVec );
+                testVec.push_back( tri->m_SplitVec[s] );
             }
         }
         else
         {
-            MassDeterIntExtTri( tri, meshVec );
+            testVec.push_back( tri );
         }
     }
+
+    ParallelFor( ( int )testVec.size(), [&]( int i )
+    {
+        MassDeterIntExtTri( testVec[i], meshVec );
+    } );
 }
 
 
@@ -2201,6 +2533,9 @@ void TTri::SplitEdges( TNode* n01, TNode* n12, TNode* n20 )
 //===============================================//
 //===============================================//
 
+//==== Build The Old Octree Instead Of The BVH (For Benchmarks) ====//
+bool TBndBox::m_OctreeFlag = false;
+
 TBndBox::TBndBox()
 {
     for ( int i = 0 ; i < 8 ; i++ )
@@ -2227,10 +2562,34 @@ void TBndBox::Reset()
 
     m_Box.Reset();
     m_TriVec.clear();
+    m_BvhVec.clear();
 }
 
-//==== Create Oct Tree of Overlaping BndBoxes ====//
+void TBndBox::SetOctreeFlag( bool flag )
+{
+    m_OctreeFlag = flag;
+}
+
+bool TBndBox::GetOctreeFlag()
+{
+    return m_OctreeFlag;
+}
+
+//==== Split Into The BVH (Or The Octree) ====//
 void TBndBox::SplitBox()
+{
+    if ( m_OctreeFlag )
+    {
+        SplitOctree();
+    }
+    else
+    {
+        BuildBvh();
+    }
+}
+
+//==== Create Oct Tree of Overlaping BndBoxes ====//
+void TBndBox::SplitOctree()
 {
     int i;
     if ( m_TriVec.size() > 32 )
@@ -2277,98 +2636,532 @@ void TBndBox::SplitBox()
         {
             for ( i = 0 ; i < 8 ; i++ )
             {
-                m_SBoxVec[i]->SplitBox();
+                m_SBoxVec[i]->SplitOctree();
             }
         }
     }
 }
 
-void TBndBox::AddTri( TTri* t )
+//==== Surface Area Of Box, Used By The SAH Cost ====//
+static double BvhBoxArea( const double* bmin, const double* bmax )
 {
-    m_TriVec.push_back( t );
-    m_Box.Update( t->m_N0->m_Pnt );
-    m_Box.Update( t->m_N1->m_Pnt );
-    m_Box.Update( t->m_N2->m_Pnt );
+    double dx = bmax[0] - bmin[0];
+    double dy = bmax[1] - bmin[1];
+    double dz = bmax[2] - bmin[2];
+
+    if ( dx < 0.0 || dy < 0.0 || dz < 0.0 )
+    {
+        return 0.0;
+    }
+
+    return 2.0 * ( dx * dy + dy * dz + dz * dx );
 }
 
-void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
+static double BvhBoxArea( const BndBox & box )
 {
-    int i;
+    vec3d bmin = box.GetMin();
+    vec3d bmax = box.GetMax();
+    return BvhBoxArea( bmin.v, bmax.v );
+}
 
-    if ( m_SBoxVec[0] )     // Keep Moving Down
+//==== Min/Max Box Accumulated In Plain Arrays While Building The BVH ====//
+struct TBvhBin
+{
+    double m_Min[3];
+    double m_Max[3];
+    int m_Num;
+
+    void Reset()
     {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i]->AddLeafNodes( leafVec );
-        }
+        m_Min[0] = m_Min[1] = m_Min[2] = 1.0e12;
+        m_Max[0] = m_Max[1] = m_Max[2] = -1.0e12;
+        m_Num = 0;
     }
-    else
+    void Update( const double* bmin, const double* bmax )
     {
-        leafVec.push_back( this );
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            m_Min[i] = min( m_Min[i], bmin[i] );
+            m_Max[i] = max( m_Max[i], bmax[i] );
+        }
     }
-}
+};
 
-bool TBndBox::CheckIntersect( TBndBox* iBox  )
+//==== Build Flat BVH, Split By The Surface Area Heuristic Over Binned Tri Centroids ====//
+// Tris are reordered in m_TriVec so each leaf holds a contiguous range.  Children
+// are stored as sibling pairs, so a node only needs the index of its first child.
+void TBndBox::BuildBvh()
 {
-    int i, j;
+    const int num_bins = 16;
+    const int leaf_min = 2;         // Never split below this
+    const int leaf_max = 8;         // Always split above this, even if the SAH says not to
+    const double trav_cost = 1.0;   // Cost of a box test relative to a tri test
 
-    //==== Compare Bounding Boxes ====//
-    if ( !Compare( m_Box, iBox->m_Box ) )
+    int i, b, ax;
+
+    m_BvhVec.clear();
+
+    int ntri = ( int )m_TriVec.size();
+    if ( ntri == 0 )
     {
-        return false;
+        return;
     }
 
-    //==== Recursively Check Sub Boxes ====//
-    if ( m_SBoxVec[0] )
+    //==== Bounding Box And Centroid Of Each Tri ====//
+    vector< double > tri_min( 3 * ntri );
+    vector< double > tri_max( 3 * ntri );
+    vector< double > tri_cent( 3 * ntri );
+    vector< int > tri_ind( ntri );
+    for ( i = 0 ; i < ntri ; i++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        TTri* t = m_TriVec[i];
+        for ( ax = 0 ; ax < 3 ; ax++ )
         {
-           if ( iBox->CheckIntersect( m_SBoxVec[i] ) )
-           return true;
+            double p0 = t->m_N0->m_Pnt[ax];
+            double p1 = t->m_N1->m_Pnt[ax];
+            double p2 = t->m_N2->m_Pnt[ax];
+            tri_min[3 * i + ax] = min( p0, min( p1, p2 ) );
+            tri_max[3 * i + ax] = max( p0, max( p1, p2 ) );
+            tri_cent[3 * i + ax] = 0.5 * ( tri_min[3 * i + ax] + tri_max[3 * i + ax] );
         }
+        tri_ind[i] = i;
     }
-    else if ( iBox->m_SBoxVec[0] )
+
+    //==== At Most 2n - 1 Nodes, Reserve So Indices Stay Valid ====//
+    m_BvhVec.reserve( 2 * ntri );
+
+    TBvhNode root;
+    root.m_Box = m_Box;
+    root.m_Child = -1;
+    root.m_Start = 0;
+    root.m_Num = ntri;
+    m_BvhVec.push_back( root );
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    TBvhBin bins[3][num_bins];
+    double right_area[num_bins];
+    int right_num[num_bins];
+
+    while ( !stack.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        int n = stack.back();
+        stack.pop_back();
+
+        int start = m_BvhVec[n].m_Start;
+        int num = m_BvhVec[n].m_Num;
+
+        if ( num <= leaf_min )
         {
-            if ( iBox->m_SBoxVec[i]->CheckIntersect( this ) )
-                return true;
+            continue;
         }
-    }
-    else
-    {
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
 
-        //==== Check All Tris In One Box Against The Other ====//
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        //==== Bounds Of The Centroids ====//
+        TBvhBin cent_box;
+        cent_box.Reset();
+        for ( i = start ; i < start + num ; i++ )
         {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
-            {
-                TTri* t1 = iBox->m_TriVec[j];
+            const double* c = &tri_cent[ 3 * tri_ind[i] ];
+            cent_box.Update( c, c );
+        }
 
-                int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
+        double parent_area = BvhBoxArea( m_BvhVec[n].m_Box );
+        if ( parent_area <= 0.0 )
+        {
+            parent_area = 1.0;
+        }
 
-                if ( iflag && !coplanarFlag )
-                    return true;
+        //==== Bin All Three Axes In One Pass ====//
+        double bin_scale[3];
+        for ( ax = 0 ; ax < 3 ; ax++ )
+        {
+            double extent = cent_box.m_Max[ax] - cent_box.m_Min[ax];
+            bin_scale[ax] = extent > 0.0 ? num_bins / extent : 0.0;
+            for ( b = 0 ; b < num_bins ; b++ )
+            {
+                bins[ax][b].Reset();
             }
         }
-    }
-    return false;
-}
 
-double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
-{
-    int i, j;
+        for ( i = start ; i < start + num ; i++ )
+        {
+            int t = tri_ind[i];
+            for ( ax = 0 ; ax < 3 ; ax++ )
+            {
+                b = min( num_bins - 1, ( int )( bin_scale[ax] * ( tri_cent[3 * t + ax] - cent_box.m_Min[ax] ) ) );
+                bins[ax][b].m_Num++;
+                bins[ax][b].Update( &tri_min[3 * t], &tri_max[3 * t] );
+            }
+        }
 
-    //==== Compare Bounding Boxes ====//
-    if ( !Compare( m_Box, iBox->m_Box, curr_min_dist ) )
-    {
+        //==== Find Cheapest Bin Boundary ====//
+        int best_axis = -1;
+        int best_bin = 0;
+        double best_cost = ( double )num;       // Cost of leaving it a leaf
+
+        for ( ax = 0 ; ax < 3 ; ax++ )
+        {
+            if ( bin_scale[ax] == 0.0 )
+            {
+                continue;
+            }
+
+            //==== Sweep From The Right To Get Area And Count Right Of Each Boundary ====//
+            TBvhBin right_box;
+            right_box.Reset();
+            for ( b = num_bins - 1 ; b > 0 ; b-- )
+            {
+                right_box.m_Num += bins[ax][b].m_Num;
+                if ( bins[ax][b].m_Num )
+                {
+                    right_box.Update( bins[ax][b].m_Min, bins[ax][b].m_Max );
+                }
+                right_num[b] = right_box.m_Num;
+                right_area[b] = BvhBoxArea( right_box.m_Min, right_box.m_Max );
+            }
+
+            //==== Sweep From The Left And Cost Each Boundary ====//
+            TBvhBin left_box;
+            left_box.Reset();
+            for ( b = 0 ; b < num_bins - 1 ; b++ )
+            {
+                left_box.m_Num += bins[ax][b].m_Num;
+                if ( bins[ax][b].m_Num )
+                {
+                    left_box.Update( bins[ax][b].m_Min, bins[ax][b].m_Max );
+                }
+
+                if ( left_box.m_Num == 0 || right_num[b + 1] == 0 )
+                {
+                    continue;
+                }
+
+                double cost = trav_cost + ( BvhBoxArea( left_box.m_Min, left_box.m_Max ) * left_box.m_Num +
+                                            right_area[b + 1] * right_num[b + 1] ) / parent_area;
+
+                if ( cost < best_cost )
+                {
+                    best_cost = cost;
+                    best_axis = ax;
+                    best_bin = b;
+                }
+            }
+        }
+
+        //==== Partition ====//
+        int mid;
+        int* first = &tri_ind[0] + start;
+        if ( best_axis >= 0 )
+        {
+            double cmin = cent_box.m_Min[best_axis];
+            double scale = bin_scale[best_axis];
+
+            int* split = std::partition( first, first + num, [&]( int t )
+            {
+                int tb = min( num_bins - 1, ( int )( scale * ( tri_cent[3 * t + best_axis] - cmin ) ) );
+                return tb <= best_bin;
+            } );
+            mid = start + ( int )( split - first );
+        }
+        else if ( num > leaf_max )
+        {
+            //==== SAH Found Nothing Better (Or All Centroids Match) - Split Largest Axis At The Median ====//
+            int split_axis = 0;
+            for ( ax = 1 ; ax < 3 ; ax++ )
+            {
+                if ( cent_box.m_Max[ax] - cent_box.m_Min[ax] > cent_box.m_Max[split_axis] - cent_box.m_Min[split_axis] )
+                {
+                    split_axis = ax;
+                }
+            }
+
+            mid = start + num / 2;
+            std::nth_element( first, &tri_ind[0] + mid, first + num, [&]( int t0, int t1 )
+            {
+                return tri_cent[3 * t0 + split_axis] < tri_cent[3 * t1 + split_axis];
+            } );
+        }
+        else
+        {
+            continue;
+        }
+
+        if ( mid == start || mid == start + num )
+        {
+            mid = start + num / 2;
+        }
+
+        //==== Add Both Children ====//
+        m_BvhVec[n].m_Child = ( int )m_BvhVec.size();
+
+        for ( int c = 0 ; c < 2 ; c++ )
+        {
+            TBvhNode child;
+            child.m_Child = -1;
+            child.m_Start = ( c == 0 ) ? start : mid;
+            child.m_Num = ( c == 0 ) ? mid - start : start + num - mid;
+
+            TBvhBin child_box;
+            child_box.Reset();
+            for ( i = child.m_Start ; i < child.m_Start + child.m_Num ; i++ )
+            {
+                child_box.Update( &tri_min[3 * tri_ind[i]], &tri_max[3 * tri_ind[i]] );
+            }
+            child.m_Box = BndBox( vec3d( child_box.m_Min[0], child_box.m_Min[1], child_box.m_Min[2] ),
+                                  vec3d( child_box.m_Max[0], child_box.m_Max[1], child_box.m_Max[2] ) );
+
+            m_BvhVec.push_back( child );
+        }
+
+        stack.push_back( m_BvhVec[n].m_Child + 1 );
+        stack.push_back( m_BvhVec[n].m_Child );
+    }
+
+    //==== Reorder Tris To Match The Leaves ====//
+    vector< TTri* > tri_vec( ntri );
+    for ( i = 0 ; i < ntri ; i++ )
+    {
+        tri_vec[i] = m_TriVec[ tri_ind[i] ];
+    }
+    m_TriVec.swap( tri_vec );
+}
+
+void TBndBox::AddTri( TTri* t )
+{
+    m_TriVec.push_back( t );
+    m_Box.Update( t->m_N0->m_Pnt );
+    m_Box.Update( t->m_N1->m_Pnt );
+    m_Box.Update( t->m_N2->m_Pnt );
+}
+
+void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
+{
+    int i;
+
+    if ( m_SBoxVec[0] )     // Keep Moving Down
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            m_SBoxVec[i]->AddLeafNodes( leafVec );
+        }
+    }
+    else
+    {
+        leafVec.push_back( this );
+    }
+}
+
+//==== Push Next Pair Of Nodes For A Dual BVH Walk - Split The Bigger Non Leaf ====//
+static void PushBvhPairs( const vector< TBvhNode > & aVec, int a, const vector< TBvhNode > & bVec, int b,
+                          vector< pair< int, int > > & stack )
+{
+    const TBvhNode & na = aVec[a];
+    const TBvhNode & nb = bVec[b];
+
+    bool split_a;
+    if ( na.m_Child < 0 )
+    {
+        split_a = false;
+    }
+    else if ( nb.m_Child < 0 )
+    {
+        split_a = true;
+    }
+    else
+    {
+        split_a = BvhBoxArea( na.m_Box ) >= BvhBoxArea( nb.m_Box );
+    }
+
+    //==== Second Child Pushed First So The First Is Walked First ====//
+    if ( split_a )
+    {
+        stack.push_back( pair< int, int >( na.m_Child + 1, b ) );
+        stack.push_back( pair< int, int >( na.m_Child, b ) );
+    }
+    else
+    {
+        stack.push_back( pair< int, int >( a, nb.m_Child + 1 ) );
+        stack.push_back( pair< int, int >( a, nb.m_Child ) );
+    }
+}
+
+//==== Do Two Tris Cross (Not Just Touch In A Plane) ====//
+static bool TriTriCross( TTri* t0, TTri* t1 )
+{
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    int iflag = tri_tri_intersect_with_isectline(
+                    t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                    t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                    &coplanarFlag, e0.v, e1.v );
+
+    return ( iflag && !coplanarFlag );
+}
+
+bool TBndBox::CheckIntersect( TBndBox* iBox  )
+{
+    int i, j;
+
+    //==== Compare Bounding Boxes ====//
+    if ( !Compare( m_Box, iBox->m_Box ) )
+    {
+        return false;
+    }
+
+    //==== BVH ====//
+    if ( m_BvhVec.size() && iBox->m_BvhVec.size() )
+    {
+        vector< pair< int, int > > stack;
+        stack.push_back( pair< int, int >( 0, 0 ) );
+
+        while ( !stack.empty() )
+        {
+            int a = stack.back().first;
+            int b = stack.back().second;
+            stack.pop_back();
+
+            const TBvhNode & na = m_BvhVec[a];
+            const TBvhNode & nb = iBox->m_BvhVec[b];
+
+            if ( !Compare( na.m_Box, nb.m_Box ) )
+            {
+                continue;
+            }
+
+            if ( na.m_Child >= 0 || nb.m_Child >= 0 )
+            {
+                PushBvhPairs( m_BvhVec, a, iBox->m_BvhVec, b, stack );
+                continue;
+            }
+
+            for ( i = na.m_Start ; i < na.m_Start + na.m_Num ; i++ )
+            {
+                for ( j = nb.m_Start ; j < nb.m_Start + nb.m_Num ; j++ )
+                {
+                    if ( TriTriCross( m_TriVec[i], iBox->m_TriVec[j] ) )
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    //==== Recursively Check Sub Boxes ====//
+    if ( m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+           if ( iBox->CheckIntersect( m_SBoxVec[i] ) )
+           return true;
+        }
+    }
+    else if ( iBox->m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            if ( iBox->m_SBoxVec[i]->CheckIntersect( this ) )
+                return true;
+        }
+    }
+    else
+    {
+        //==== Check All Tris In One Box Against The Other ====//
+        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        {
+            TTri* t0 = m_TriVec[i];
+            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
+            {
+                if ( TriTriCross( t0, iBox->m_TriVec[j] ) )
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+//==== Min Distance Between Two Boxes, Zero If They Overlap ====//
+static double BvhBoxDist( const BndBox & a, const BndBox & b )
+{
+    double d2 = 0.0;
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        double gap = max( a.GetMin( i ) - b.GetMax( i ), b.GetMin( i ) - a.GetMax( i ) );
+        if ( gap > 0.0 )
+        {
+            d2 += gap * gap;
+        }
+    }
+    return sqrt( d2 );
+}
+
+//==== Min Distance Between Two Tris ====//
+static double TriTriDist( TTri* t0, TTri* t1 )
+{
+    return tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
+                             t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt );
+}
+
+double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
+{
+    int i, j;
+
+    //==== Compare Bounding Boxes ====//
+    if ( !Compare( m_Box, iBox->m_Box, curr_min_dist ) )
+    {
+        return curr_min_dist;
+    }
+
+    //==== BVH ====//
+    if ( m_BvhVec.size() && iBox->m_BvhVec.size() )
+    {
+        vector< pair< int, int > > stack;
+        stack.push_back( pair< int, int >( 0, 0 ) );
+
+        while ( !stack.empty() )
+        {
+            int a = stack.back().first;
+            int b = stack.back().second;
+            stack.pop_back();
+
+            const TBvhNode & na = m_BvhVec[a];
+            const TBvhNode & nb = iBox->m_BvhVec[b];
+
+            if ( BvhBoxDist( na.m_Box, nb.m_Box ) >= curr_min_dist )
+            {
+                continue;
+            }
+
+            //==== Walk The Nearer Child Pair First So The Min Drops Quickly ====//
+            if ( na.m_Child >= 0 || nb.m_Child >= 0 )
+            {
+                PushBvhPairs( m_BvhVec, a, iBox->m_BvhVec, b, stack );
+
+                int n = ( int )stack.size();
+                double d0 = BvhBoxDist( m_BvhVec[ stack[n - 1].first ].m_Box, iBox->m_BvhVec[ stack[n - 1].second ].m_Box );
+                double d1 = BvhBoxDist( m_BvhVec[ stack[n - 2].first ].m_Box, iBox->m_BvhVec[ stack[n - 2].second ].m_Box );
+                if ( d1 < d0 )
+                {
+                    std::swap( stack[n - 1], stack[n - 2] );
+                }
+                continue;
+            }
+
+            for ( i = na.m_Start ; i < na.m_Start + na.m_Num ; i++ )
+            {
+                for ( j = nb.m_Start ; j < nb.m_Start + nb.m_Num ; j++ )
+                {
+                    double d = TriTriDist( m_TriVec[i], iBox->m_TriVec[j] );
+
+                    if ( d < curr_min_dist )
+                        curr_min_dist = d;
+                }
+            }
+        }
         return curr_min_dist;
     }
 
@@ -2395,10 +3188,7 @@ double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
             TTri* t0 = m_TriVec[i];
             for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
             {
-
-                TTri* t1 = iBox->m_TriVec[j];
-                double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
-                                             t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt);
+                double d = TriTriDist( t0, iBox->m_TriVec[j] );
 
                 if ( d < curr_min_dist )
                     curr_min_dist = d;
@@ -2409,16 +3199,173 @@ double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
     return curr_min_dist;
 }
 
+//==== Intersect Two Tris And Add The Intersection Edge To Both ====//
+static void IntersectTriPair( TTri* t0, TTri* t1, bool UWFlag )
+{
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    int iflag = tri_tri_intersect_with_isectline(
+                    t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                    t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                    &coplanarFlag, e0.v, e1.v );
+
+    if ( !iflag || coplanarFlag || dist( e0, e1 ) <= 0.000001 )
+    {
+        return;
+    }
+
+    if ( UWFlag )
+    {
+        // Figure out with tri has xyz info
+        TTri* tri;
+        int d_info = TNode::HAS_XYZ; // desired info number
+        if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
+                && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
+        {
+            tri = t0;
+        }
+        else
+        {
+            tri = t1;
+        }
+        // Use Bilinear interpolation to convert edge uw points to xyz points
+        vec3d e0xyz = tri->CompPnt( e0 );
+        vec3d e1xyz = tri->CompPnt( e1 );
+
+        // Create the new edges
+
+        TEdge* ie0 = new TEdge();
+        int info = TNode::HAS_UW | TNode::HAS_XYZ;
+        ie0->m_N0 = new TNode();
+        ie0->m_N0->SetUWPnt( e0 );
+        ie0->m_N0->SetXYZPnt( e0xyz );
+        ie0->m_N0->MakePntUW();
+        ie0->m_N0->SetCoordInfo( info );
+        ie0->m_N1 = new TNode();
+        ie0->m_N1->SetUWPnt( e1 );
+        ie0->m_N1->SetXYZPnt( e1xyz );
+        ie0->m_N1->MakePntUW();
+        ie0->m_N1->SetCoordInfo( info );
+
+        TEdge* ie1 = new TEdge();
+        ie1->m_N0 = new TNode();
+        ie1->m_N0->SetUWPnt( e0 );
+        ie1->m_N0->SetXYZPnt( e0xyz );
+        ie1->m_N0->MakePntUW();
+        ie1->m_N0->SetCoordInfo( info );
+        ie1->m_N1 = new TNode();
+        ie1->m_N1->SetUWPnt( e1 );
+        ie1->m_N1->SetXYZPnt( e1xyz );
+        ie1->m_N1->MakePntUW();
+        ie1->m_N1->SetCoordInfo( info );
+
+        t0->m_ISectEdgeVec.push_back( ie0 );
+        t1->m_ISectEdgeVec.push_back( ie1 );
+
+        if ( tri->GetTMeshPtr() )
+        {
+            tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
+        }
+    }
+    else
+    {
+        TEdge* ie0 = new TEdge();
+        ie0->m_N0 = new TNode();
+        ie0->m_N0->m_Pnt = e0;
+        ie0->m_N1 = new TNode();
+        ie0->m_N1->m_Pnt = e1;
+
+        TEdge* ie1 = new TEdge();
+        ie1->m_N0 = new TNode();
+        ie1->m_N0->m_Pnt = e0;
+        ie1->m_N1 = new TNode();
+        ie1->m_N1->m_Pnt = e1;
+
+        t0->m_ISectEdgeVec.push_back( ie0 );
+        t1->m_ISectEdgeVec.push_back( ie1 );
+    }
+}
+
+//==== Record The Intersection Segment Of Two Tris Without Changing Them ====//
+static void FindTriPairIntersection( TTri* t0, TTri* t1, vector< TISect > & isectVec )
+{
+    int coplanarFlag;
+    TISect isect;
+
+    int iflag = tri_tri_intersect_with_isectline(
+                    t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                    t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                    &coplanarFlag, isect.m_E0.v, isect.m_E1.v );
+
+    if ( iflag && !coplanarFlag && dist( isect.m_E0, isect.m_E1 ) > 0.000001 )
+    {
+        isect.m_Tri0 = t0;
+        isect.m_Tri1 = t1;
+        isectVec.push_back( isect );
+    }
+}
+
+//==== Find The Overlapping Leaf Pairs Of Two BVHs, In Walk Order ====//
+void TBndBox::FindBvhLeafPairs( TBndBox* iBox, vector< pair< int, int > > & leafPairVec )
+{
+    vector< pair< int, int > > stack;
+    stack.push_back( pair< int, int >( 0, 0 ) );
+
+    while ( !stack.empty() )
+    {
+        int a = stack.back().first;
+        int b = stack.back().second;
+        stack.pop_back();
+
+        if ( !Compare( m_BvhVec[a].m_Box, iBox->m_BvhVec[b].m_Box ) )
+        {
+            continue;
+        }
+
+        if ( m_BvhVec[a].m_Child >= 0 || iBox->m_BvhVec[b].m_Child >= 0 )
+        {
+            PushBvhPairs( m_BvhVec, a, iBox->m_BvhVec, b, stack );
+        }
+        else
+        {
+            leafPairVec.push_back( pair< int, int >( a, b ) );
+        }
+    }
+}
 
 void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
 {
-    int i;
+    int i, j;
 
     if ( !Compare( m_Box, iBox->m_Box ) )
     {
         return;
     }
 
+    //==== BVH - Leaf Pairs Are Found First, Adding Edges Can Move UW Nodes ====//
+    if ( m_BvhVec.size() && iBox->m_BvhVec.size() )
+    {
+        vector< pair< int, int > > leafPairVec;
+        FindBvhLeafPairs( iBox, leafPairVec );
+
+        for ( int p = 0 ; p < ( int )leafPairVec.size() ; p++ )
+        {
+            const TBvhNode & na = m_BvhVec[ leafPairVec[p].first ];
+            const TBvhNode & nb = iBox->m_BvhVec[ leafPairVec[p].second ];
+
+            for ( i = na.m_Start ; i < na.m_Start + na.m_Num ; i++ )
+            {
+                for ( j = nb.m_Start ; j < nb.m_Start + nb.m_Num ; j++ )
+                {
+                    IntersectTriPair( m_TriVec[i], iBox->m_TriVec[j], UWFlag );
+                }
+            }
+        }
+        return;
+    }
+
     if ( m_SBoxVec[0] )
     {
         for ( i = 0 ; i < 8 ; i++ )
@@ -2435,137 +3382,146 @@ void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
     }
     else
     {
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
-
-        int iCnt = 0;
-
         for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
         {
             TTri* t0 = m_TriVec[i];
-            for ( int j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
+            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
             {
-                TTri* t1 = iBox->m_TriVec[j];
+                IntersectTriPair( t0, iBox->m_TriVec[j], UWFlag );
+            }
+        }
+    }
+}
 
-                int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
+//==== Same Traversal As Intersect (Non UW), But Only Records The Segments ====//
+void TBndBox::FindIntersections( TBndBox* iBox, vector< TISect > & isectVec )
+{
+    int i, j;
 
-                iCnt += iflag;
-                if ( iflag && !coplanarFlag )
+    if ( !Compare( m_Box, iBox->m_Box ) )
+    {
+        return;
+    }
+
+    //==== BVH ====//
+    if ( m_BvhVec.size() && iBox->m_BvhVec.size() )
+    {
+        vector< pair< int, int > > leafPairVec;
+        FindBvhLeafPairs( iBox, leafPairVec );
+
+        for ( int p = 0 ; p < ( int )leafPairVec.size() ; p++ )
+        {
+            const TBvhNode & na = m_BvhVec[ leafPairVec[p].first ];
+            const TBvhNode & nb = iBox->m_BvhVec[ leafPairVec[p].second ];
+
+            for ( i = na.m_Start ; i < na.m_Start + na.m_Num ; i++ )
+            {
+                for ( j = nb.m_Start ; j < nb.m_Start + nb.m_Num ; j++ )
                 {
-                    if ( UWFlag )
-                    {
-                        if ( dist( e0, e1 ) > 0.000001 )
-                        {
-                            // Figure out with tri has xyz info
-                            TTri* tri;
-                            int d_info = TNode::HAS_XYZ; // desired info number
-                            if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
-                                    && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
-                            {
-                                tri = t0;
-                            }
-                            else
-                            {
-                                tri = t1;
-                            }
-                            // Use Bilinear interpolation to convert edge uw points to xyz points
-                            vec3d e0xyz = tri->CompPnt( e0 );
-                            vec3d e1xyz = tri->CompPnt( e1 );
-
-                            // Create the new edges
-
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->SetUWPnt( e0 );
-                            ie0->m_N0->SetXYZPnt( e0xyz );
-                            ie0->m_N0->MakePntUW();
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->SetUWPnt( e1 );
-                            ie0->m_N1->SetXYZPnt( e1xyz );
-                            ie0->m_N1->MakePntUW();
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->SetUWPnt( e0 );
-                            ie1->m_N0->SetXYZPnt( e0xyz );
-                            ie1->m_N0->MakePntUW();
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->SetUWPnt( e1 );
-                            ie1->m_N1->SetXYZPnt( e1xyz );
-                            ie1->m_N1->MakePntUW();
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-
-                            if ( tri->GetTMeshPtr() )
-                            {
-                                tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
-                            }
+                    FindTriPairIntersection( m_TriVec[i], iBox->m_TriVec[j], isectVec );
+                }
+            }
+        }
+        return;
+    }
 
-                        }
-                    }
-                    else
-                    {
-                        TEdge* ie0 = new TEdge();
-                        ie0->m_N0 = new TNode();
-                        ie0->m_N0->m_Pnt = e0;
-                        ie0->m_N1 = new TNode();
-                        ie0->m_N1->m_Pnt = e1;
+    if ( m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            iBox->FindIntersections( m_SBoxVec[i], isectVec );
+        }
+    }
+    else if ( iBox->m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            iBox->m_SBoxVec[i]->FindIntersections( this, isectVec );
+        }
+    }
+    else
+    {
+        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        {
+            TTri* t0 = m_TriVec[i];
+            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
+            {
+                FindTriPairIntersection( t0, iBox->m_TriVec[j], isectVec );
+            }
+        }
+    }
+}
 
-                        TEdge* ie1 = new TEdge();
-                        ie1->m_N0 = new TNode();
-                        ie1->m_N0->m_Pnt = e0;
-                        ie1->m_N1 = new TNode();
-                        ie1->m_N1->m_Pnt = e1;
+//==== Add Ray Parameter For A Tri Hit, Unless It Is Already There (Shared Edge/Node) ====//
+static void AddRayTriHit( TTri* tri, vec3d & orig, vec3d & dir, vector<double> & tParmVec )
+{
+    double tparm, uparm, vparm;
 
+    int iFlag = intersect_triangle( orig.v, dir.v,
+                                    tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
 
-                        if ( dist( e0, e1 ) > 0.000001 )
-                        {
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-                        }
-                        else
-                        {
-                            delete ie0->m_N0;
-                            delete ie0->m_N1;
-                            delete ie1->m_N0;
-                            delete ie1->m_N1;
-                            delete ie0;
-                            delete ie1;
-                        }
-                    }
-                }
+    if ( iFlag && tparm > 0.0 )
+    {
+        //==== Find If T is Already Included ====//
+        for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+        {
+            if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
+            {
+                return;
             }
         }
+
+        tParmVec.push_back( tparm );
     }
 }
+
+//==== Is Pnt Inside The YZ Extent Of A Box ====//
+static bool InsideYZ( const BndBox & box, const vec3d & orig )
+{
+    return !( orig.y() < box.GetMin( 1 ) || orig.y() > box.GetMax( 1 ) ||
+              orig.z() < box.GetMin( 2 ) || orig.z() > box.GetMax( 2 ) );
+}
+
 void  TBndBox::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
 {
     int i;
 
-    if ( orig.y() < m_Box.GetMin( 1 ) )
-    {
-        return;
-    }
-    if ( orig.y() > m_Box.GetMax( 1 ) )
+    if ( !InsideYZ( m_Box, orig ) )
     {
         return;
     }
-    if ( orig.z() < m_Box.GetMin( 2 ) )
-    {
-        return;
-    }
-    if ( orig.z() > m_Box.GetMax( 2 ) )
+
+    vec3d dir( 1.0, 0.0, 0.0 );
+
+    //==== BVH ====//
+    if ( m_BvhVec.size() )
     {
+        vector< int > stack;
+        stack.push_back( 0 );
+
+        while ( !stack.empty() )
+        {
+            const TBvhNode & node = m_BvhVec[ stack.back() ];
+            stack.pop_back();
+
+            if ( !InsideYZ( node.m_Box, orig ) )
+            {
+                continue;
+            }
+
+            if ( node.m_Child >= 0 )
+            {
+                stack.push_back( node.m_Child + 1 );
+                stack.push_back( node.m_Child );
+            }
+            else
+            {
+                for ( i = node.m_Start ; i < node.m_Start + node.m_Num ; i++ )
+                {
+                    AddRayTriHit( m_TriVec[i], orig, dir, tParmVec );
+                }
+            }
+        }
         return;
     }
 
@@ -2579,32 +3535,9 @@ void  TBndBox::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
     }
 
     //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-    vec3d dir( 1.0, 0.0, 0.0 );
     for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
     {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
-
-        if ( iFlag && tparm > 0.0 )
-        {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
-            {
-                if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
-                {
-                    dupFlag = 1;
-                    break;
-                }
-            }
-
-            if ( !dupFlag )
-            {
-                tParmVec.push_back( tparm );
-            }
-        }
+        AddRayTriHit( m_TriVec[i], orig, dir, tParmVec );
     }
 
 }
@@ -2620,6 +3553,38 @@ void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
         return;
     }
 
+    //==== BVH ====//
+    if ( m_BvhVec.size() )
+    {
+        vector< int > stack;
+        stack.push_back( 0 );
+
+        while ( !stack.empty() )
+        {
+            const TBvhNode & node = m_BvhVec[ stack.back() ];
+            stack.pop_back();
+
+            if ( !intersectRayAABB( node.m_Box.GetMin().v, node.m_Box.GetMax().v, orig.v, dir.v, coord ) )
+            {
+                continue;
+            }
+
+            if ( node.m_Child >= 0 )
+            {
+                stack.push_back( node.m_Child + 1 );
+                stack.push_back( node.m_Child );
+            }
+            else
+            {
+                for ( i = node.m_Start ; i < node.m_Start + node.m_Num ; i++ )
+                {
+                    AddRayTriHit( m_TriVec[i], orig, dir, tParmVec );
+                }
+            }
+        }
+        return;
+    }
+
     if ( m_SBoxVec[0] )
     {
         for ( i = 0 ; i < 8 ; i++ )
@@ -2630,40 +3595,105 @@ void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
     }
 
     //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-
     for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
     {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+        AddRayTriHit( m_TriVec[i], orig, dir, tParmVec );
+    }
+
+}
+
+//==== Does Segment p0 - p1 Touch A Box (Slab Test) ====//
+static bool SegHitsBox( const BndBox & box, const vec3d & p0, const vec3d & p1 )
+{
+    double tmin = 0.0;
+    double tmax = 1.0;
 
-        if ( iFlag && tparm > 0.0 )
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        double d = p1[i] - p0[i];
+        if ( std::abs( d ) < 1.0e-300 )
         {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+            if ( p0[i] < box.GetMin( i ) || p0[i] > box.GetMax( i ) )
             {
-                if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
-                {
-                    dupFlag = 1;
-                    break;
-                }
+                return false;
             }
-
-            if ( !dupFlag )
+        }
+        else
+        {
+            double t0 = ( box.GetMin( i ) - p0[i] ) / d;
+            double t1 = ( box.GetMax( i ) - p0[i] ) / d;
+            if ( t0 > t1 )
+            {
+                std::swap( t0, t1 );
+            }
+            tmin = max( tmin, t0 );
+            tmax = min( tmax, t1 );
+            if ( tmin > tmax )
             {
-                tParmVec.push_back( tparm );
+                return false;
             }
         }
     }
+    return true;
+}
+
+//==== Add Point Where Segment Crosses A Tri ====//
+static void AddSegTriHit( TTri* tri, vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
+{
+    double tparm, uparm, vparm;
 
+    vec3d n0pnt  = tri->m_N0->m_Pnt;
+    vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
+    vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
+    vec3d p10    = p1 - p0;
+    if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
+                            p0, p10, uparm, vparm, tparm ) )
+    {
+        vec3d pnt = p0 + ( p1 - p0 ) * tparm;
+        ipntVec.push_back( pnt );
+    }
 }
 
+//==== Segment Intersection ====//
+// The BVH path slab tests the whole segment against each node box, so every tri the
+// segment crosses is reported.  The octree path only descends into boxes that hold an
+// endpoint, so it misses tris between the endpoints and can return fewer points.
 void TBndBox::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
 {
     int i, t;
 
+    //==== BVH ====//
+    if ( m_BvhVec.size() )
+    {
+        vector< int > stack;
+        stack.push_back( 0 );
+
+        while ( !stack.empty() )
+        {
+            const TBvhNode & node = m_BvhVec[ stack.back() ];
+            stack.pop_back();
+
+            if ( !SegHitsBox( node.m_Box, p0, p1 ) )
+            {
+                continue;
+            }
+
+            if ( node.m_Child >= 0 )
+            {
+                stack.push_back( node.m_Child + 1 );
+                stack.push_back( node.m_Child );
+            }
+            else
+            {
+                for ( t = node.m_Start ; t < node.m_Start + node.m_Num ; t++ )
+                {
+                    AddSegTriHit( m_TriVec[t], p0, p1, ipntVec );
+                }
+            }
+        }
+        return;
+    }
+
     if ( !m_Box.CheckPnt( p0.x(), p0.y(), p0.z() ) && !m_Box.CheckPnt( p1.x(), p1.y(), p1.z() ) )
     {
         return;
@@ -2679,20 +3709,9 @@ void TBndBox::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
     }
 
     //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
     for ( t = 0 ; t < ( int )m_TriVec.size() ; t++ )
     {
-        TTri* tri = m_TriVec[t];
-        vec3d n0pnt  = tri->m_N0->m_Pnt;
-        vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d p10    = p1 - p0;
-        if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
-                                p0, p10, uparm, vparm, tparm ) )
-        {
-            vec3d pnt = p0 + ( p1 - p0 ) * tparm;
-            ipntVec.push_back( pnt );
-        }
+        AddSegTriHit( m_TriVec[t], p0, p1, ipntVec );
     }
 
 }
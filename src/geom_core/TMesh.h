@@ -104,6 +104,52 @@ public:
     double m_Iyz;
 };
 
+//==== Running Mass Property Sums - Built Up Element By Element Instead Of Storing Elements ====//
+class MassPropSum
+{
+public:
+    MassPropSum();
+    MassPropSum( const vec3d & ref );
+
+    void AddTetra( double den, const vec3d& p0, const vec3d& p1, const vec3d& p2, const vec3d& p3 );
+    void AddTriShell( double mass_area, const vec3d& p0, const vec3d& p1, const vec3d& p2 );
+    void AddPointMass( double mass, const vec3d& pos );
+
+    //==== Sums Must Share The Same Reference Point ====//
+    void Add( const MassPropSum & sum );
+
+    double GetVol() const;
+    double GetMass() const;
+    vec3d GetCG() const;
+
+    //==== Inertia About GetCG() ====//
+    void GetInertia( double & ixx, double & iyy, double & izz, double & ixy, double & ixz, double & iyz ) const;
+
+protected:
+
+    enum { VOL, MASS, MX, MY, MZ, MXX, MYY, MZZ, MXY, MXZ, MYZ, IXX, IYY, IZZ, IXY, IXZ, IYZ, NUM_TERMS };
+
+    void AddElement( double vol, double mass, const vec3d & cg, const double inertia[6] );
+
+    //==== Kahan Summation ====//
+    void AddTerm( int term, double val )
+    {
+        double y = val - m_Comp[term];
+        double t = m_Sum[term] + y;
+        m_Comp[term] = ( t - m_Sum[term] ) - y;
+        m_Sum[term] = t;
+    }
+
+    double GetTerm( int term ) const
+    {
+        return m_Sum[term] - m_Comp[term];
+    }
+
+    vec3d m_Ref;                        // Moments are taken about this point to limit cancellation
+    double m_Sum[NUM_TERMS];
+    double m_Comp[NUM_TERMS];
+};
+
 //===========================================================================================================//
 //================================================ DegenGeom ================================================//
 //===========================================================================================================//
@@ -344,6 +390,24 @@ private:
 
 };
 
+//==== Intersection Segment Between Two Tris, Before Edges Are Added ====//
+struct TISect
+{
+    TTri* m_Tri0;
+    TTri* m_Tri1;
+    vec3d m_E0;
+    vec3d m_E1;
+};
+
+//==== Node Of A Flat Bounding Volume Hierarchy ====//
+struct TBvhNode
+{
+    BndBox m_Box;
+    int m_Child;                // Index Of First Child, Second Child Follows It.  -1 For Leaf
+    int m_Start;                // Leaf Tris Are TBndBox::m_TriVec[ m_Start ] ... [ m_Start + m_Num - 1 ]
+    int m_Num;
+};
+
 class TBndBox
 {
 public:
@@ -355,19 +419,34 @@ public:
     BndBox m_Box;
     vector< TTri* > m_TriVec;
 
-    TBndBox* m_SBoxVec[8];      // Split Bnd Boxes
+    TBndBox* m_SBoxVec[8];      // Split Bnd Boxes (Octree)
+    vector< TBvhNode > m_BvhVec; // SAH Bounding Volume Hierarchy, Root Is m_BvhVec[0]
+
+    //==== Build The Old Octree Instead Of The BVH - For Benchmarks ====//
+    static void SetOctreeFlag( bool flag );
+    static bool GetOctreeFlag();
 
     void SplitBox();
+    void SplitOctree();
+    void BuildBvh();
     void AddTri( TTri* t );
     virtual void Intersect( TBndBox* iBox, bool UWFlag = false );
+    virtual void FindIntersections( TBndBox* iBox, vector< TISect > & isectVec );
     virtual void NumCrossXRay( vec3d & orig, vector<double> & tParmVec );
     virtual void RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec );
     virtual void AddLeafNodes( vector< TBndBox* > & leafVec );
 
+    // Reports every tri the segment crosses when the BVH is built (see TMesh.cpp)
     virtual void SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec );
     virtual bool CheckIntersect( TBndBox* iBox );
     virtual double MinDistance( TBndBox* iBox, double curr_min_dist );
 
+protected:
+
+    void FindBvhLeafPairs( TBndBox* iBox, vector< pair< int, int > > & leafPairVec );
+
+    static bool m_OctreeFlag;
+
 };
 
 class Geom;
@@ -386,11 +465,15 @@ public:
 
     void copy( TMesh* m );
     void CopyFlatten( TMesh* m );
-    virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
+    virtual xmlNodePtr EncodeXml( xmlNodePtr & node, bool binary_flag = false );
     virtual void DecodeXml( xmlNodePtr & node );
     virtual xmlNodePtr EncodeTriList( xmlNodePtr & node );
     virtual void DecodeTriList( xmlNodePtr & node, int num_tris );
 
+    //==== Shared Nodes And Tri Indices As Base64 Arrays ====//
+    virtual xmlNodePtr EncodeIndexedMesh( xmlNodePtr & node );
+    virtual bool DecodeIndexedMesh( xmlNodePtr & node );
+
     //==== Stuff Copied From Geom That Created This Mesh ====//
     string m_PtrID;
     //bool reflected_flag;
@@ -417,6 +500,8 @@ public:
     void LoadGeomAttributes( Geom* geomPtr );
     int  RemoveDegenerate();
     void Intersect( TMesh* tm, bool UWFlag = false );
+    void FindIntersections( TMesh* tm, vector< TISect > & isectVec );
+    static void AddISectEdges( const vector< TISect > & isectVec );
     bool CheckIntersect( TMesh* tm );
     double MinDistance( TMesh* tm, double curr_min_dist );
     void Split();
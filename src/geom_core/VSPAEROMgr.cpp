@@ -18,6 +18,10 @@
 
 #include <regex>
 
+#ifdef VSP_USE_VSPAERO_LIBRARY
+#include "solver/VSPAERO_Lib.H"
+#endif
+
 //==== Constructor ====//
 VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
 {
@@ -587,6 +591,13 @@ Optional input of logFile allows outputting to a log file or the console
 string VSPAEROMgrSingleton::ComputeSolver( FILE * logFile )
 {
     UpdateFilenames();
+#ifdef VSP_USE_VSPAERO_LIBRARY
+    // Stability runs still need the executable for the .stab file
+    if ( !m_StabilityCalcFlag.Get() )
+    {
+        return ComputeSolverInProcess( logFile );
+    }
+#endif
     if ( m_BatchModeFlag.Get() )
     {
         return ComputeSolverBatch( logFile );
@@ -934,6 +945,146 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
     }
 }
 
+#ifdef VSP_USE_VSPAERO_LIBRARY
+/* ComputeSolverInProcess(FILE * logFile)
+Solves every flow condition with the linked solver library. The geometry file is
+read, and the solver set up, once for all conditions. The wake iteration history
+goes straight into VSPAERO_History results, with no solver output files.
+*/
+string VSPAEROMgrSingleton::ComputeSolverInProcess( FILE * logFile )
+{
+    std::vector <string> res_id_vector;
+
+    Vehicle *veh = VehicleMgr.GetVehicle();
+
+    if ( veh )
+    {
+        vsp::VSPAERO_ANALYSIS_METHOD analysisMethod = ( vsp::VSPAERO_ANALYSIS_METHOD )m_AnalysisMethod.Get();
+
+        vector<double> alphaVec;
+        vector<double> betaVec;
+        vector<double> machVec;
+        GetSweepVectors( alphaVec, betaVec, machVec );
+
+        VSPAERO_LIB solver;
+
+        solver.Sref() = m_Sref();
+        solver.Cref() = m_cref();
+        solver.Bref() = m_bref();
+        solver.Xcg() = m_Xcg();
+        solver.Ycg() = m_Ycg();
+        solver.Zcg() = m_Zcg();
+        solver.WakeIterations() = m_WakeNumIter();
+        solver.NumberOfThreads() = m_NCPU();
+        if ( m_WakeAvgStartIter() >= 1 )
+        {
+            solver.ForceAveragingIteration() = m_WakeAvgStartIter();
+        }
+        if ( m_WakeSkipUntilIter() >= 1 )
+        {
+            solver.NoWakeIteration() = m_WakeSkipUntilIter();
+        }
+
+        if ( logFile )
+        {
+            fprintf( logFile, "VSPAERO in process: %s\n", m_ModelNameBase.c_str() );
+        }
+
+        if ( !solver.LoadGeometry( m_ModelNameBase.c_str() ) )
+        {
+            fprintf( stderr, "ERROR %d: Could not load VSPAERO geometry: %s\n\tFile: %s \tLine:%d\n", vsp::VSP_FILE_READ_FAILURE, m_ModelNameBase.c_str(), __FILE__, __LINE__ );
+            return string();
+        }
+
+        for ( int iAlpha = 0; iAlpha < alphaVec.size(); iAlpha++ )
+        {
+            for ( int iBeta = 0; iBeta < betaVec.size(); iBeta++ )
+            {
+                for ( int iMach = 0; iMach < machVec.size(); iMach++ )
+                {
+                    if ( m_SolverProcessKill )
+                    {
+                        m_SolverProcessKill = false;    //reset kill flag
+
+                        return string();    //return empty result ID vector
+                    }
+
+                    solver.Solve( machVec[iMach], alphaVec[iAlpha], betaVec[iBeta] );
+
+                    Results* res = ResultsMgr.CreateResults( "VSPAERO_History" );
+                    if ( !res )
+                    {
+                        fprintf( stderr, "ERROR: Unable to create result in result manager \n\tFile: %s \tLine:%d\n", __FILE__, __LINE__ );
+                        return string();
+                    }
+                    res_id_vector.push_back( res->GetID() );
+
+                    // Same names as the case header of the .history file
+                    res->Add( NameValData( "FC_Sref_", m_Sref() ) );
+                    res->Add( NameValData( "FC_Cref_", m_cref() ) );
+                    res->Add( NameValData( "FC_Bref_", m_bref() ) );
+                    res->Add( NameValData( "FC_Xcg_", m_Xcg() ) );
+                    res->Add( NameValData( "FC_Ycg_", m_Ycg() ) );
+                    res->Add( NameValData( "FC_Zcg_", m_Zcg() ) );
+                    res->Add( NameValData( "FC_Mach_", solver.Mach() ) );
+                    res->Add( NameValData( "FC_AoA_", solver.AoA() ) );
+                    res->Add( NameValData( "FC_Beta_", solver.Beta() ) );
+                    AddResultHeader( res->GetID(), solver.Mach(), solver.AoA(), solver.Beta(), analysisMethod );
+
+                    // Wake iteration table
+                    const char *names[VSPAERO_LIB_HISTORY_COLUMNS] = { "WakeIter", "Mach", "Alpha", "Beta", "CL", "CDo", "CDi", "CDtot", "CS",
+                                                                       "L/D", "E", "CFx", "CFy", "CFz", "CMx", "CMy", "CMz", "T/QS" };
+
+                    int nhist = solver.NumberOfHistoryEntries();
+                    if ( nhist > 0 && solver.History( nhist, VSPAERO_LIB_HISTORY_ITER ) == 99999 )
+                    {
+                        nhist--;    // force averaged entry, written as a separate table by the executable
+                    }
+
+                    std::vector<int> iter( nhist );
+                    for ( int i = 0; i < nhist; i++ )
+                    {
+                        iter[i] = ( int )solver.History( i + 1, VSPAERO_LIB_HISTORY_ITER );
+                    }
+                    res->Add( NameValData( names[0], iter ) );
+
+                    for ( int j = 1; j < VSPAERO_LIB_HISTORY_COLUMNS; j++ )
+                    {
+                        std::vector<double> column( nhist );
+                        for ( int i = 0; i < nhist; i++ )
+                        {
+                            column[i] = solver.History( i + 1, j );
+                        }
+                        res->Add( NameValData( names[j], column ) );
+                    }
+
+                    // Send the message to update the screens
+                    MessageData data;
+                    data.m_String = "UpdateAllScreens";
+                    MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+
+                }    //Mach sweep loop
+
+            }    //beta sweep loop
+
+        }    //alpha sweep loop
+
+    }
+
+    // Create "wrapper" result to contain a vector of result IDs (this maintains compatibility to return a single result after computation)
+    Results *res = ResultsMgr.CreateResults( "VSPAERO_Wrapper" );
+    if( !res )
+    {
+        return string();
+    }
+    else
+    {
+        res->Add( NameValData( "ResultsVec", res_id_vector ) );
+        return res->GetID();
+    }
+}
+#endif
+
 void VSPAEROMgrSingleton::MonitorSolver( FILE * logFile )
 {
     // ==== MonitorSolverProcess ==== //
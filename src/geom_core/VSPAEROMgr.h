@@ -45,6 +45,9 @@ public:
     string ComputeSolver( FILE * logFile = NULL ); // returns a result with a vector of results id's under the name ResultVec
     string ComputeSolverBatch( FILE * logFile = NULL );
     string ComputeSolverSingle( FILE * logFile = NULL );
+#ifdef VSP_USE_VSPAERO_LIBRARY
+    string ComputeSolverInProcess( FILE * logFile = NULL );
+#endif
     ProcessUtil* GetSolverProcess();
     bool IsSolverRunning();
     void KillSolver();
@@ -23,6 +23,7 @@
 #include "AdvLinkMgr.h"
 #include "AnalysisMgr.h"
 #include "Quat.h"
+#include "ParallelUtil.h"
 #include "StringUtil.h"
 #include "SubSurfaceMgr.h"
 #include "DesignVarMgr.h"
@@ -104,7 +105,18 @@ Vehicle::Vehicle()
 
     m_STLMultiSolid.Init( "MultiSolid", "STLSettings", this, false, 0, 1 );
 
+    m_BinaryMeshFlag.Init( "BinaryMesh", "VSP3Settings", this, false, 0, 1 );
+    m_BinaryMeshFlag.SetDescript( "Write MeshGeom meshes as indexed base64 arrays instead of text tri lists" );
+
     m_UpdatingBBox = false;
+
+    m_UpdateDirtyOnlyFlag = true;
+    m_NumGeomUpdated = 0;
+    m_NumGeomSkipped = 0;
+
+    m_ParallelUpdateFlag = true;
+    m_DeferDrawObjFlag = false;
+
     m_BbXLen.Init( "X_Len", "BBox", this, 0, 0, 1e12 );
     m_BbXLen.SetDescript( "X length of vehicle bounding box" );
     m_BbYLen.Init( "Y_Len", "BBox", this, 0, 0, 1e12 );
@@ -247,6 +259,8 @@ void Vehicle::Init()
 
     m_STLMultiSolid.Set( false );
 
+    m_BinaryMeshFlag.Set( false );
+
     m_BEMPropID = string();
 
     m_UpdatingBBox = false;
@@ -302,6 +316,7 @@ void Vehicle::Wype()
     }
 
     m_GeomStoreVec.clear();
+    m_GeomIDMap.clear();
 
     m_ActiveGeom.clear();
     m_TopGeom.clear();
@@ -375,6 +390,12 @@ void Vehicle::ParmChanged( Parm* parm_ptr, int type )
         return;
     }
 
+    //==== Batched Parm Sets Refresh The Vehicle Once, When Committed ====//
+    if ( LinkMgr.IsBatchActive() && parm_ptr != &m_AxisLength )
+    {
+        return;
+    }
+
     m_UpdatingBBox = true;
     UpdateBBox();
     m_UpdatingBBox = false;
@@ -402,14 +423,69 @@ void Vehicle::UnDo()
 //===== Update All Geometry ====//
 void Vehicle::Update( bool fullupdate )
 {
+    m_NumGeomUpdated = 0;
+    m_NumGeomSkipped = 0;
+
+    m_DeferDrawObjFlag = m_ParallelUpdateFlag && GetNumParallelThreads() > 1;
+
     for ( int i = 0 ; i < ( int )m_TopGeom.size() ; i++ )
     {
         Geom* g_ptr = FindGeom( m_TopGeom[i] );
         if ( g_ptr )
         {
-            g_ptr->Update( fullupdate );
+            if ( m_UpdateDirtyOnlyFlag )
+            {
+                g_ptr->UpdateDirty( fullupdate, m_NumGeomUpdated, m_NumGeomSkipped );
+            }
+            else
+            {
+                vector< string > id_vec;
+                g_ptr->LoadIDAndChildren( id_vec );
+                m_NumGeomUpdated += ( int )id_vec.size();
+
+                g_ptr->Update( fullupdate );
+            }
         }
     }
+
+    m_DeferDrawObjFlag = false;
+    UpdateDeferredDrawObjs();
+}
+
+//==== Hold Back UpdateDrawObj So It Can Be Tessellated With Other Geoms ====//
+bool Vehicle::DeferDrawObj( Geom* geom_ptr )
+{
+    if ( !m_DeferDrawObjFlag )
+    {
+        return false;
+    }
+
+    if ( !vector_contains_val( m_DeferDrawObjVec, geom_ptr ) )
+    {
+        m_DeferDrawObjVec.push_back( geom_ptr );
+    }
+    return true;
+}
+
+void Vehicle::UpdateDeferredDrawObjs()
+{
+    vector< Geom* > geom_vec;
+    geom_vec.swap( m_DeferDrawObjVec );
+
+    //==== Surface Tessellation Touches Only Each Geom's Own Data ====//
+    ParallelFor( ( int )geom_vec.size(), [&]( int i )
+    {
+        if ( geom_vec[i]->UsesPreTess() )
+        {
+            geom_vec[i]->PreTessDrawObj();
+        }
+    } );
+
+    //==== Rest Of The Draw Objects Stay On This Thread, In Update Order ====//
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        geom_vec[i]->UpdateDeferredDrawObj();
+    }
 }
 
 void Vehicle::ForceUpdate()
@@ -439,16 +515,57 @@ Geom* Vehicle::FindGeom( const string & geom_id )
     {
         return NULL;
     }
+
+    //==== Decoding Can Remap A Stored Geom's ID, So Confirm The Hit ====//
+    unordered_map< string, Geom* >::iterator it = m_GeomIDMap.find( geom_id );
+    if ( it != m_GeomIDMap.end() )
+    {
+        if ( it->second->IsMatch( geom_id ) )
+        {
+            return it->second;
+        }
+        m_GeomIDMap.erase( it );
+    }
+
     for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
     {
         if ( m_GeomStoreVec[i]->IsMatch( geom_id ) )
         {
+            m_GeomIDMap[ geom_id ] = m_GeomStoreVec[i];
             return m_GeomStoreVec[i];
         }
     }
     return NULL;
 }
 
+void Vehicle::AddGeomStore( Geom* geom_ptr )
+{
+    m_GeomStoreVec.push_back( geom_ptr );
+    m_GeomIDMap[ geom_ptr->GetID() ] = geom_ptr;
+}
+
+//==== Drop Every Index Entry For The Geom - Old IDs May Still Point To It ====//
+void Vehicle::RemoveGeomStore( Geom* geom_ptr )
+{
+    vector_remove_val( m_GeomStoreVec, geom_ptr );
+
+    //==== Geoms Deleted During Update, e.g. Conformal Copies, Must Not Be Tessellated Later ====//
+    vector_remove_val( m_DeferDrawObjVec, geom_ptr );
+
+    unordered_map< string, Geom* >::iterator it = m_GeomIDMap.begin();
+    while ( it != m_GeomIDMap.end() )
+    {
+        if ( it->second == geom_ptr )
+        {
+            it = m_GeomIDMap.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
 //==== Find Vector of Geom Ptrs Based on GeomID ====//
 vector< Geom* > Vehicle::FindGeomVec( const vector< string > & geom_id_vec )
 {
@@ -527,7 +644,7 @@ string Vehicle::CreateGeom( const GeomType & type )
         new_geom->Update();
     }
 
-    m_GeomStoreVec.push_back( new_geom );
+    AddGeomStore( new_geom );
 
     Geom* type_geom_ptr = FindGeom( type.m_GeomID );
     if ( type_geom_ptr )
@@ -956,7 +1073,7 @@ void Vehicle::DeleteClipBoard()
         Geom* gPtr = FindGeom( m_ClipBoard[i] );
         if ( gPtr )
         {
-            vector_remove_val( m_GeomStoreVec, gPtr );
+            RemoveGeomStore( gPtr );
             delete gPtr;
         }
     }
@@ -968,7 +1085,7 @@ void Vehicle::DeleteGeom( const string & geom_id )
     Geom* gPtr = FindGeom( geom_id );
     if ( gPtr )
     {
-        vector_remove_val( m_GeomStoreVec, gPtr );
+        RemoveGeomStore( gPtr );
         vector_remove_val( m_ActiveGeom, geom_id );
         delete gPtr;
     }
@@ -1331,7 +1448,7 @@ void Vehicle::DeleteType( int index )
     Geom* gPtr = FindGeom( type.m_GeomID );
     if ( gPtr )
     {
-        vector_remove_val( m_GeomStoreVec, gPtr );
+        RemoveGeomStore( gPtr );
         delete gPtr;
     }
 
@@ -36,6 +36,7 @@
 #include <deque>
 #include <stack>
 #include <memory>
+#include <unordered_map>
 
 
 #define MIN_FILE_VER 4 // Lowest file version number for 3.X vsp file
@@ -81,6 +82,17 @@ public:
 
     void Update( bool fullupdate = true );
     void ForceUpdate();
+
+    //==== Skip Geoms With No Changed Parms, Counts From The Last Update ====//
+    void SetUpdateDirtyOnlyFlag( bool flag )                        { m_UpdateDirtyOnlyFlag = flag; }
+    bool GetUpdateDirtyOnlyFlag()                                   { return m_UpdateDirtyOnlyFlag; }
+    int GetNumGeomUpdated()                                         { return m_NumGeomUpdated; }
+    int GetNumGeomSkipped()                                         { return m_NumGeomSkipped; }
+
+    //==== Tessellate Updated Geoms Concurrently - False Forces Serial ====//
+    void SetParallelUpdateFlag( bool flag )                         { m_ParallelUpdateFlag = flag; }
+    bool GetParallelUpdateFlag()                                    { return m_ParallelUpdateFlag; }
+    bool DeferDrawObj( Geom* geom_ptr );
     void UpdateGui();
     void RunScript( const string & file_name, const string & function_name = "void main()" );
 
@@ -348,6 +360,8 @@ public:
 
     BoolParm m_STLMultiSolid;
 
+    BoolParm m_BinaryMeshFlag;
+
     BoolParm m_exportCompGeomCsvFile;
     BoolParm m_exportDragBuildTsvFile;
     BoolParm m_exportDegenGeomCsvFile;
@@ -358,6 +372,10 @@ public:
 protected:
 
     vector< Geom* > m_GeomStoreVec;                 // All Geom Ptrs
+    unordered_map< string, Geom* > m_GeomIDMap;     // FindGeom index, checked against the Geom ID on use
+
+    void AddGeomStore( Geom* geom_ptr );
+    void RemoveGeomStore( Geom* geom_ptr );
 
     vector< DegenGeom > m_DegenGeomVec;         // Vector of components in degenerate representation
     vector< DegenPtMass > m_DegenPtMassVec;
@@ -375,6 +393,15 @@ protected:
     bool m_UpdatingBBox;
     BndBox m_BBox;                              // Bounding Box Around All Geometries
 
+    bool m_UpdateDirtyOnlyFlag;
+    int m_NumGeomUpdated;
+    int m_NumGeomSkipped;
+
+    bool m_ParallelUpdateFlag;
+    bool m_DeferDrawObjFlag;
+    vector< Geom* > m_DeferDrawObjVec;          // Geoms whose UpdateDrawObj waits for the end of Update
+    void UpdateDeferredDrawObjs();
+
     void SetApplyAbsIgnoreFlag( const vector< string > &g_vec, bool val );
 
     //==== Primary file name ====//
@@ -2233,6 +2233,9 @@ void FileXSec::SetPnts( vector< vec3d > & pnt_vec )
         double y = pnt_vec[i].y() / m_Height();
         m_UnityFilePnts.push_back( vec3d( x, y, 0.0 ) );
     }
+
+    //==== Points Are Not Parms - Width And Height May Be Unchanged ====//
+    ParmChanged( NULL, Parm::SET );
 }
 
 void FileXSec::ReadV2FileFuse2( xmlNodePtr &root )
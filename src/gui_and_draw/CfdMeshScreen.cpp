@@ -896,18 +896,27 @@ void * cfdmonitorfun( void *data )
             running = CfdMeshMgr.GetMeshInProgress();
             nread = 0;
 
-            int ig = CfdMeshMgr.m_OutStream.tellg();
-            CfdMeshMgr.m_OutStream.seekg( 0, CfdMeshMgr.m_OutStream.end );
-            nread = (int)(CfdMeshMgr.m_OutStream.tellg()) - ig;
-            CfdMeshMgr.m_OutStream.seekg( ig );
-
-            if( nread > 0 )
+            char * buffer = NULL;
             {
-                char * buffer = new char [nread+1];
+                // Remesh threads append to the stream while we read it.
+                lock_guard< mutex > lock( CfdMeshMgr.m_OutStreamMutex );
 
-                CfdMeshMgr.m_OutStream.read( buffer, nread );
-                buffer[nread]=0;
+                int ig = CfdMeshMgr.m_OutStream.tellg();
+                CfdMeshMgr.m_OutStream.seekg( 0, CfdMeshMgr.m_OutStream.end );
+                nread = (int)(CfdMeshMgr.m_OutStream.tellg()) - ig;
+                CfdMeshMgr.m_OutStream.seekg( ig );
 
+                if( nread > 0 )
+                {
+                    buffer = new char [nread+1];
+
+                    CfdMeshMgr.m_OutStream.read( buffer, nread );
+                    buffer[nread]=0;
+                }
+            }
+
+            if( nread > 0 )
+            {
                 Fl::lock();
                 // Any FL calls must occur between Fl::lock() and Fl::unlock().
                 cs->AddOutputText( buffer );
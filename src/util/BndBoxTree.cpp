@@ -0,0 +1,168 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// BndBoxTree.cpp: Bounding volume hierarchy over a set of boxes.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "BndBoxTree.h"
+
+#include <algorithm>
+
+BndBoxTree::BndBoxTree()
+{
+}
+
+void BndBoxTree::Clear()
+{
+    m_NodeVec.clear();
+    m_IndVec.clear();
+    m_BoxVec.clear();
+}
+
+//==== Build Hierarchy - Median Split On The Longest Axis Of The Box Centers ====//
+void BndBoxTree::Build( const vector< BndBox > & box_vec )
+{
+    Clear();
+
+    m_BoxVec = box_vec;
+    m_IndVec.resize( box_vec.size() );
+    for ( int i = 0 ; i < ( int )box_vec.size() ; i++ )
+    {
+        m_IndVec[i] = i;
+    }
+
+    if ( !box_vec.empty() )
+    {
+        m_NodeVec.reserve( 2 * box_vec.size() );
+        BuildNode( 0, ( int )box_vec.size() );
+    }
+}
+
+int BndBoxTree::BuildNode( int start, int num )
+{
+    int node_ind = ( int )m_NodeVec.size();
+    m_NodeVec.push_back( BndBoxTreeNode() );
+
+    BndBox cent_box;
+    for ( int i = start ; i < start + num ; i++ )
+    {
+        m_NodeVec[node_ind].m_Box.Update( m_BoxVec[ m_IndVec[i] ] );
+        cent_box.Update( m_BoxVec[ m_IndVec[i] ].GetCenter() );
+    }
+    m_NodeVec[node_ind].m_Child[0] = m_NodeVec[node_ind].m_Child[1] = -1;
+    m_NodeVec[node_ind].m_Start = start;
+    m_NodeVec[node_ind].m_Num = num;
+
+    if ( num <= 4 )
+    {
+        return node_ind;
+    }
+
+    int axis = 0;
+    for ( int d = 1 ; d < 3 ; d++ )
+    {
+        if ( cent_box.GetMax( d ) - cent_box.GetMin( d ) > cent_box.GetMax( axis ) - cent_box.GetMin( axis ) )
+        {
+            axis = d;
+        }
+    }
+
+    int half = num / 2;
+    const vector< BndBox > & boxes = m_BoxVec;
+    std::nth_element( m_IndVec.begin() + start, m_IndVec.begin() + start + half, m_IndVec.begin() + start + num,
+                      [&]( int a, int b )
+                      {
+                          return boxes[a].GetCenter()[axis] < boxes[b].GetCenter()[axis];
+                      } );
+
+    int c0 = BuildNode( start, half );
+    int c1 = BuildNode( start + half, num - half );
+    m_NodeVec[node_ind].m_Child[0] = c0;
+    m_NodeVec[node_ind].m_Child[1] = c1;
+
+    return node_ind;
+}
+
+void BndBoxTree::FindOverlaps( const BndBox & box, vector< int > & ind_vec ) const
+{
+    ind_vec.clear();
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    int stack[64];
+    int nstack = 0;
+    stack[nstack++] = 0;
+    while ( nstack > 0 )
+    {
+        const BndBoxTreeNode & node = m_NodeVec[ stack[--nstack] ];
+
+        if ( !Compare( node.m_Box, box ) )
+        {
+            continue;
+        }
+
+        if ( node.m_Child[0] < 0 )
+        {
+            for ( int i = node.m_Start ; i < node.m_Start + node.m_Num ; i++ )
+            {
+                if ( Compare( m_BoxVec[ m_IndVec[i] ], box ) )
+                {
+                    ind_vec.push_back( m_IndVec[i] );
+                }
+            }
+        }
+        else
+        {
+            stack[nstack++] = node.m_Child[0];
+            stack[nstack++] = node.m_Child[1];
+        }
+    }
+
+    //==== Same Order As A Linear Scan Over The Boxes ====//
+    std::sort( ind_vec.begin(), ind_vec.end() );
+}
+
+void BndBoxTree::FindContaining( const vec3d & pnt, vector< int > & ind_vec ) const
+{
+    ind_vec.clear();
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    int stack[64];
+    int nstack = 0;
+    stack[nstack++] = 0;
+    while ( nstack > 0 )
+    {
+        const BndBoxTreeNode & node = m_NodeVec[ stack[--nstack] ];
+
+        if ( !node.m_Box.CheckPnt( pnt ) )
+        {
+            continue;
+        }
+
+        if ( node.m_Child[0] < 0 )
+        {
+            for ( int i = node.m_Start ; i < node.m_Start + node.m_Num ; i++ )
+            {
+                if ( m_BoxVec[ m_IndVec[i] ].CheckPnt( pnt ) )
+                {
+                    ind_vec.push_back( m_IndVec[i] );
+                }
+            }
+        }
+        else
+        {
+            stack[nstack++] = node.m_Child[0];
+            stack[nstack++] = node.m_Child[1];
+        }
+    }
+
+    std::sort( ind_vec.begin(), ind_vec.end() );
+}
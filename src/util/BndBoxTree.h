@@ -0,0 +1,62 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//******************************************************************************
+//
+//   Bounding Box Tree
+//
+//   Bounding volume hierarchy over a fixed set of boxes, for finding which
+//   boxes overlap a query box or contain a query point without testing them
+//   all.  Built once, then read only, so it may be queried from many threads.
+//
+//******************************************************************************
+
+#if !defined(BNDBOXTREE__INCLUDED_)
+#define BNDBOXTREE__INCLUDED_
+
+#include "BndBox.h"
+
+#include <vector>
+using std::vector;
+
+class BndBoxTree
+{
+public:
+
+    BndBoxTree();
+
+    void Build( const vector< BndBox > & box_vec );
+    void Clear();
+
+    bool IsEmpty() const
+    {
+        return m_NodeVec.empty();
+    }
+
+    //==== Indices Of Boxes Overlapping box, In Ascending Order ====//
+    void FindOverlaps( const BndBox & box, vector< int > & ind_vec ) const;
+
+    //==== Indices Of Boxes Containing pnt, In Ascending Order ====//
+    void FindContaining( const vec3d & pnt, vector< int > & ind_vec ) const;
+
+protected:
+
+    class BndBoxTreeNode
+    {
+    public:
+        BndBox m_Box;
+        int m_Child[2];         // -1 for a leaf
+        int m_Start;            // Leaf range in m_IndVec
+        int m_Num;
+    };
+
+    int BuildNode( int start, int num );
+
+    vector< BndBoxTreeNode > m_NodeVec;
+    vector< int > m_IndVec;
+    vector< BndBox > m_BoxVec;
+};
+
+#endif
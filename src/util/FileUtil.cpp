@@ -17,6 +17,7 @@
 #include <unistd.h>
 #include <libgen.h>
 #include <pwd.h>
+#include <sys/stat.h>
 #endif
 
 
@@ -272,6 +273,25 @@ bool FileExist( const string & file )
     }
 }
 
+// Create a single directory level - true if it exists afterward
+bool MakeDir( const string & dir_path )
+{
+#ifdef WIN32
+    if ( CreateDirectoryA( dir_path.c_str(), NULL ) )
+    {
+        return true;
+    }
+    return GetLastError() == ERROR_ALREADY_EXISTS;
+#else
+    if ( mkdir( dir_path.c_str(), 0755 ) == 0 )
+    {
+        return true;
+    }
+    struct stat st;
+    return stat( dir_path.c_str(), &st ) == 0 && S_ISDIR( st.st_mode );
+#endif
+}
+
 // This is similar to basename() on linux and returns the last portion of the pathfile string
 string GetFilename( const string &pathfile )
 {
@@ -0,0 +1,818 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#include "MeshFileUtil.h"
+#include "ParallelUtil.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//==== Tris Handled By One Task When Reading Binary STL ====//
+static const int STL_BLOCK_TRIS = 1 << 16;
+
+//==== Smallest File Split Into Parallel Chunks When Reading ASCII STL ====//
+static const size_t STL_MIN_CHUNK_BYTES = 1 << 22;
+
+//==============================================================================//
+//================================ Mapped File =================================//
+//==============================================================================//
+
+MappedFile::MappedFile()
+{
+    m_Data = NULL;
+    m_Size = 0;
+    m_MapPtr = NULL;
+#ifdef WIN32
+    m_FileHandle = NULL;
+    m_MapHandle = NULL;
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open( const char* file_name )
+{
+    Close();
+
+#ifdef WIN32
+    HANDLE file = CreateFileA( file_name, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+    if ( file == INVALID_HANDLE_VALUE )
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if ( !GetFileSizeEx( file, &size ) )
+    {
+        CloseHandle( file );
+        return false;
+    }
+    m_Size = ( size_t ) size.QuadPart;
+
+    if ( m_Size > 0 )
+    {
+        HANDLE map = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+        if ( map )
+        {
+            m_MapPtr = MapViewOfFile( map, FILE_MAP_READ, 0, 0, 0 );
+            if ( m_MapPtr )
+            {
+                m_FileHandle = file;
+                m_MapHandle = map;
+                m_Data = ( const char* ) m_MapPtr;
+                return true;
+            }
+            CloseHandle( map );
+        }
+    }
+    CloseHandle( file );
+#else
+    int fd = open( file_name, O_RDONLY );
+    if ( fd < 0 )
+    {
+        return false;
+    }
+
+    struct stat st;
+    if ( fstat( fd, &st ) != 0 )
+    {
+        close( fd );
+        return false;
+    }
+    m_Size = ( size_t ) st.st_size;
+
+    if ( m_Size > 0 )
+    {
+        void* ptr = mmap( NULL, m_Size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( ptr != MAP_FAILED )
+        {
+#ifdef MADV_SEQUENTIAL
+            madvise( ptr, m_Size, MADV_SEQUENTIAL );
+#endif
+            close( fd );
+            m_MapPtr = ptr;
+            m_Data = ( const char* ) ptr;
+            return true;
+        }
+    }
+    close( fd );
+#endif
+
+    //==== Mapping Failed Or Empty File - Read Into Memory ====//
+    m_Buffer.resize( m_Size + 1, 0 );
+    if ( m_Size > 0 )
+    {
+        FILE* fp = fopen( file_name, "rb" );
+        if ( !fp )
+        {
+            Close();
+            return false;
+        }
+        m_Size = fread( &m_Buffer[0], 1, m_Size, fp );
+        fclose( fp );
+    }
+    m_Data = &m_Buffer[0];
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if ( m_MapPtr )
+    {
+#ifdef WIN32
+        UnmapViewOfFile( m_MapPtr );
+        CloseHandle( ( HANDLE ) m_MapHandle );
+        CloseHandle( ( HANDLE ) m_FileHandle );
+        m_MapHandle = NULL;
+        m_FileHandle = NULL;
+#else
+        munmap( m_MapPtr, m_Size );
+#endif
+        m_MapPtr = NULL;
+    }
+
+    m_Buffer.clear();
+    m_Data = NULL;
+    m_Size = 0;
+}
+
+//==============================================================================//
+//=============================== Number Parsing ===============================//
+//==============================================================================//
+
+static inline bool IsSpace( char c )
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v';
+}
+
+static inline bool IsDigit( char c )
+{
+    return c >= '0' && c <= '9';
+}
+
+static inline void SkipSpace( const char* & ptr, const char* end )
+{
+    while ( ptr < end && IsSpace( *ptr ) )
+    {
+        ptr++;
+    }
+}
+
+static inline void SkipToken( const char* & ptr, const char* end )
+{
+    SkipSpace( ptr, end );
+    while ( ptr < end && !IsSpace( *ptr ) )
+    {
+        ptr++;
+    }
+}
+
+static inline void SkipLine( const char* & ptr, const char* end )
+{
+    while ( ptr < end && *ptr != '\n' )
+    {
+        ptr++;
+    }
+}
+
+//==== Scan A Number Starting At ptr - Up To 19 Significant Digits In mant, Value Is mant * 10^exp10 ====//
+// exact is false when digits were dropped. Returns false with no digits, else p is the end of the number.
+static bool ScanNumber( const char* ptr, const char* end, bool & neg, uint64_t & mant, int & num_sig, int & exp10, bool & exact, const char* & p )
+{
+    p = ptr;
+
+    neg = false;
+    if ( p < end && ( *p == '-' || *p == '+' ) )
+    {
+        neg = ( *p == '-' );
+        p++;
+    }
+
+    mant = 0;
+    num_sig = 0;                        // Significant digits kept in mant
+    exp10 = 0;
+    exact = true;
+    bool any_digit = false;
+
+    while ( p < end && IsDigit( *p ) )
+    {
+        any_digit = true;
+        if ( num_sig < 19 )
+        {
+            mant = mant * 10 + ( *p - '0' );
+            if ( mant )
+            {
+                num_sig++;
+            }
+        }
+        else
+        {
+            exp10++;
+            exact = false;
+        }
+        p++;
+    }
+
+    if ( p < end && *p == '.' )
+    {
+        p++;
+        while ( p < end && IsDigit( *p ) )
+        {
+            any_digit = true;
+            if ( num_sig < 19 )
+            {
+                mant = mant * 10 + ( *p - '0' );
+                if ( mant )
+                {
+                    num_sig++;
+                }
+                exp10--;
+            }
+            else
+            {
+                exact = false;
+            }
+            p++;
+        }
+    }
+
+    if ( !any_digit )
+    {
+        return false;
+    }
+
+    if ( p < end && ( *p == 'e' || *p == 'E' ) )
+    {
+        const char* e = p + 1;
+        bool eneg = false;
+        if ( e < end && ( *e == '-' || *e == '+' ) )
+        {
+            eneg = ( *e == '-' );
+            e++;
+        }
+        if ( e < end && IsDigit( *e ) )
+        {
+            int ex = 0;
+            while ( e < end && IsDigit( *e ) )
+            {
+                if ( ex < 100000 )
+                {
+                    ex = ex * 10 + ( *e - '0' );
+                }
+                e++;
+            }
+            exp10 += eneg ? -ex : ex;
+            p = e;
+        }
+    }
+
+    return true;
+}
+
+//==== Copy The Number Between ptr And p For strtod/strtof ====//
+static bool CopyNumber( const char* ptr, const char* p, char* buff, size_t buff_len )
+{
+    size_t len = ( size_t )( p - ptr );
+    if ( len >= buff_len )
+    {
+        return false;
+    }
+    memcpy( buff, ptr, len );
+    buff[len] = '\0';
+    return true;
+}
+
+//==== Parse A Number - Exact For Up To 15 Significant Digits And Small Exponents, Else strtod ====//
+bool MeshFileUtil::ParseDouble( const char* & ptr, const char* end, double & val )
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+    SkipSpace( ptr, end );
+
+    bool neg, exact;
+    uint64_t mant;
+    int num_sig, exp10;
+    const char* p;
+    if ( !ScanNumber( ptr, end, neg, mant, num_sig, exp10, exact, p ) )
+    {
+        return false;
+    }
+
+    if ( exact && num_sig <= 15 && exp10 >= -22 && exp10 <= 22 )
+    {
+        // Both mant and 10^|exp10| are exact doubles, so one rounding gives the correctly rounded value.
+        double v = ( double ) mant;
+        v = ( exp10 < 0 ) ? v / pow10[ -exp10 ] : v * pow10[ exp10 ];
+        val = neg ? -v : v;
+    }
+    else
+    {
+        char buff[128];
+        if ( !CopyNumber( ptr, p, buff, sizeof( buff ) ) )
+        {
+            return false;
+        }
+        val = strtod( buff, NULL );
+    }
+
+    ptr = p;
+    return true;
+}
+
+//==== Parse A Number Rounded To float As By fscanf %f - Exact Fast Path For 7 Digits, Else strtof ====//
+bool MeshFileUtil::ParseFloat( const char* & ptr, const char* end, float & val )
+{
+    static const float pow10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+    SkipSpace( ptr, end );
+
+    bool neg, exact;
+    uint64_t mant;
+    int num_sig, exp10;
+    const char* p;
+    if ( !ScanNumber( ptr, end, neg, mant, num_sig, exp10, exact, p ) )
+    {
+        return false;
+    }
+
+    if ( exact && num_sig <= 7 && exp10 >= -10 && exp10 <= 10 )
+    {
+        // Both mant and 10^|exp10| are exact floats, so one rounding gives the correctly rounded value.
+        float v = ( float ) mant;
+        v = ( exp10 < 0 ) ? v / pow10[ -exp10 ] : v * pow10[ exp10 ];
+        val = neg ? -v : v;
+    }
+    else
+    {
+        char buff[128];
+        if ( !CopyNumber( ptr, p, buff, sizeof( buff ) ) )
+        {
+            return false;
+        }
+        val = strtof( buff, NULL );
+    }
+
+    ptr = p;
+    return true;
+}
+
+bool MeshFileUtil::ParseInt( const char* & ptr, const char* end, int & val )
+{
+    SkipSpace( ptr, end );
+    const char* p = ptr;
+
+    bool neg = false;
+    if ( p < end && ( *p == '-' || *p == '+' ) )
+    {
+        neg = ( *p == '-' );
+        p++;
+    }
+
+    if ( p >= end || !IsDigit( *p ) )
+    {
+        return false;
+    }
+
+    long long v = 0;
+    while ( p < end && IsDigit( *p ) )
+    {
+        if ( v < 10000000000LL )
+        {
+            v = v * 10 + ( *p - '0' );
+        }
+        p++;
+    }
+
+    val = ( int )( neg ? -v : v );
+    ptr = p;
+    return true;
+}
+
+//==============================================================================//
+//================================ Point Merging ===============================//
+//==============================================================================//
+
+static inline uint64_t DoubleBits( double d )
+{
+    if ( d == 0.0 )
+    {
+        d = 0.0;                        // -0.0 and 0.0 are the same point
+    }
+    uint64_t b;
+    memcpy( &b, &d, sizeof( b ) );
+    return b;
+}
+
+static inline uint64_t HashPnt( const vec3d & p )
+{
+    uint64_t h = DoubleBits( p.x() ) * 0x9E3779B97F4A7C15ULL;
+    h = ( h ^ ( h >> 29 ) ) + DoubleBits( p.y() ) * 0xC2B2AE3D27D4EB4FULL;
+    h = ( h ^ ( h >> 32 ) ) + DoubleBits( p.z() ) * 0x165667B19E3779F9ULL;
+    return h ^ ( h >> 31 );
+}
+
+static inline bool SamePnt( const vec3d & a, const vec3d & b )
+{
+    return a.x() == b.x() && a.y() == b.y() && a.z() == b.z();
+}
+
+//==== Hash The Points Into Partitions, Each Partition Finds The First Copy Of Its Points ====//
+// Shared points are numbered in order of first use, so the result does not
+// depend on the number of threads.
+void MeshFileUtil::MergeIdenticalPnts( const vector< vec3d > & pnt_vec, vector< vec3d > & unique_vec, vector< int > & index_vec )
+{
+    int npnt = ( int )pnt_vec.size();
+
+    vector< uint64_t > hash_vec( npnt );
+    int nblock = ( npnt + STL_BLOCK_TRIS - 1 ) / STL_BLOCK_TRIS;
+    ParallelFor( nblock, [&]( int b )
+    {
+        int iend = std::min( npnt, ( b + 1 ) * STL_BLOCK_TRIS );
+        for ( int i = b * STL_BLOCK_TRIS ; i < iend ; i++ )
+        {
+            hash_vec[i] = HashPnt( pnt_vec[i] );
+        }
+    } );
+
+    int npart = std::max( 1, std::min( GetNumParallelThreads(), 64 ) );
+
+    //==== first_vec[i] Is The Index Of The First Point Equal To Point i ====//
+    vector< int > first_vec( npnt );
+    ParallelFor( npart, [&]( int part )
+    {
+        int count = 0;
+        for ( int i = 0 ; i < npnt ; i++ )
+        {
+            if ( ( int )( ( hash_vec[i] >> 48 ) % npart ) == part )
+            {
+                count++;
+            }
+        }
+
+        uint64_t mask = 1;
+        while ( mask < 2 * ( uint64_t ) count )
+        {
+            mask <<= 1;
+        }
+        mask--;
+
+        vector< int > table( mask + 1, -1 );
+        for ( int i = 0 ; i < npnt ; i++ )
+        {
+            if ( ( int )( ( hash_vec[i] >> 48 ) % npart ) != part )
+            {
+                continue;
+            }
+
+            uint64_t slot = hash_vec[i] & mask;
+            while ( true )
+            {
+                int j = table[slot];
+                if ( j < 0 )
+                {
+                    table[slot] = i;
+                    first_vec[i] = i;
+                    break;
+                }
+                if ( hash_vec[j] == hash_vec[i] && SamePnt( pnt_vec[j], pnt_vec[i] ) )
+                {
+                    first_vec[i] = j;
+                    break;
+                }
+                slot = ( slot + 1 ) & mask;
+            }
+        }
+    } );
+
+    unique_vec.clear();
+    index_vec.resize( npnt );
+    for ( int i = 0 ; i < npnt ; i++ )
+    {
+        if ( first_vec[i] == i )
+        {
+            index_vec[i] = ( int )unique_vec.size();
+            unique_vec.push_back( pnt_vec[i] );
+        }
+        else
+        {
+            index_vec[i] = index_vec[ first_vec[i] ];
+        }
+    }
+}
+
+//==============================================================================//
+//==================================== STL =====================================//
+//==============================================================================//
+
+static inline uint32_t ReadLEUint32( const char* ptr )
+{
+    const unsigned char* b = ( const unsigned char* ) ptr;
+    return ( uint32_t ) b[0] | ( ( uint32_t ) b[1] << 8 ) | ( ( uint32_t ) b[2] << 16 ) | ( ( uint32_t ) b[3] << 24 );
+}
+
+static inline double ReadLEFloat( const char* ptr )
+{
+    uint32_t u = ReadLEUint32( ptr );
+    float f;
+    memcpy( &f, &u, sizeof( f ) );
+    return f;
+}
+
+static inline bool TokenIs( const char* tok, size_t len, const char* word )
+{
+    return len == strlen( word ) && strncmp( tok, word, len ) == 0;
+}
+
+//==== Parse Whole Facets Between start And end - False On A Malformed Number ====//
+static bool ParseAsciiSTL( const char* ptr, const char* end, vector< vec3d > & corner_vec, vector< vec3d > & norm_vec )
+{
+    vec3d norm;
+    vec3d vert[3];
+    int nvert = 0;
+
+    while ( true )
+    {
+        SkipSpace( ptr, end );
+        if ( ptr >= end )
+        {
+            break;
+        }
+
+        const char* tok = ptr;
+        while ( ptr < end && !IsSpace( *ptr ) )
+        {
+            ptr++;
+        }
+        size_t len = ( size_t )( ptr - tok );
+
+        if ( TokenIs( tok, len, "facet" ) )
+        {
+            SkipToken( ptr, end );      // normal
+            float n[3];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                if ( !MeshFileUtil::ParseFloat( ptr, end, n[k] ) )
+                {
+                    return false;
+                }
+            }
+            norm.set_xyz( n[0], n[1], n[2] );
+            nvert = 0;
+        }
+        else if ( TokenIs( tok, len, "vertex" ) )
+        {
+            float v[3];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                if ( !MeshFileUtil::ParseFloat( ptr, end, v[k] ) )
+                {
+                    return false;
+                }
+            }
+            if ( nvert < 3 )
+            {
+                vert[nvert].set_xyz( v[0], v[1], v[2] );
+            }
+            nvert++;
+        }
+        else if ( TokenIs( tok, len, "endfacet" ) )
+        {
+            if ( nvert == 3 )
+            {
+                corner_vec.push_back( vert[0] );
+                corner_vec.push_back( vert[1] );
+                corner_vec.push_back( vert[2] );
+                norm_vec.push_back( norm );
+            }
+            nvert = 0;
+        }
+        else if ( TokenIs( tok, len, "solid" ) || TokenIs( tok, len, "endsolid" ) )
+        {
+            SkipLine( ptr, end );       // Solid name
+        }
+    }
+    return true;
+}
+
+//==== First Position After An endfacet At Or After ptr ====//
+static const char* NextFacetStart( const char* ptr, const char* end )
+{
+    static const char word[] = "endfacet";
+    static const size_t len = sizeof( word ) - 1;
+
+    while ( ptr + len <= end )
+    {
+        if ( *ptr == 'e' && strncmp( ptr, word, len ) == 0 )
+        {
+            return ptr + len;
+        }
+        ptr++;
+    }
+    return end;
+}
+
+bool MeshFileUtil::ReadSTL( const char* file_name, IndexedMeshData & mesh, bool parallel )
+{
+    mesh = IndexedMeshData();
+
+    MappedFile file;
+    if ( !file.Open( file_name ) )
+    {
+        return false;
+    }
+
+    const char* data = file.GetData();
+    size_t size = file.GetSize();
+
+    //==== Binary When The Facet Count Matches The Size Or The File Does Not Start With solid ====//
+    bool binary = false;
+    uint32_t num_facet = 0;
+    if ( size >= 84 )
+    {
+        num_facet = ReadLEUint32( data + 80 );
+        binary = ( 84 + 50 * ( uint64_t ) num_facet == size );
+    }
+    if ( !binary && size >= 84 )
+    {
+        const char* p = data;
+        const char* end = data + size;
+        SkipSpace( p, end );
+        binary = !( p + 5 <= end && strncmp( p, "solid", 5 ) == 0 );
+        num_facet = ( uint32_t ) std::min( ( uint64_t ) num_facet, ( uint64_t )( size - 84 ) / 50 );
+    }
+
+    vector< vec3d > corner_vec;
+
+    if ( binary )
+    {
+        int ntri = ( int ) num_facet;
+        corner_vec.resize( 3 * ntri );
+        mesh.m_NormVec.resize( ntri );
+
+        int nblock = ( ntri + STL_BLOCK_TRIS - 1 ) / STL_BLOCK_TRIS;
+        auto read_block = [&]( int b )
+        {
+            int iend = std::min( ntri, ( b + 1 ) * STL_BLOCK_TRIS );
+            for ( int i = b * STL_BLOCK_TRIS ; i < iend ; i++ )
+            {
+                const char* f = data + 84 + 50 * ( size_t ) i;
+                mesh.m_NormVec[i].set_xyz( ReadLEFloat( f ), ReadLEFloat( f + 4 ), ReadLEFloat( f + 8 ) );
+                for ( int k = 0 ; k < 3 ; k++ )
+                {
+                    const char* v = f + 12 + 12 * k;
+                    corner_vec[ 3 * i + k ].set_xyz( ReadLEFloat( v ), ReadLEFloat( v + 4 ), ReadLEFloat( v + 8 ) );
+                }
+            }
+        };
+
+        if ( parallel )
+        {
+            ParallelFor( nblock, read_block );
+        }
+        else
+        {
+            for ( int b = 0 ; b < nblock ; b++ )
+            {
+                read_block( b );
+            }
+        }
+    }
+    else
+    {
+        const char* end = data + size;
+
+        //==== Split Into Chunks Of Whole Facets ====//
+        int nchunk = 1;
+        if ( parallel )
+        {
+            nchunk = ( int ) std::min( ( size_t ) 4 * GetNumParallelThreads(), size / STL_MIN_CHUNK_BYTES + 1 );
+        }
+
+        vector< const char* > start_vec( nchunk + 1 );
+        start_vec[0] = data;
+        start_vec[nchunk] = end;
+        for ( int c = 1 ; c < nchunk ; c++ )
+        {
+            const char* guess = std::max( start_vec[c - 1], data + ( size / nchunk ) * c );
+            start_vec[c] = NextFacetStart( guess, end );
+        }
+
+        vector< vector< vec3d > > chunk_corner_vec( nchunk );
+        vector< vector< vec3d > > chunk_norm_vec( nchunk );
+        vector< char > chunk_ok_vec( nchunk, 0 );
+        ParallelFor( nchunk, [&]( int c )
+        {
+            chunk_ok_vec[c] = ParseAsciiSTL( start_vec[c], start_vec[c + 1], chunk_corner_vec[c], chunk_norm_vec[c] );
+        } );
+
+        for ( int c = 0 ; c < nchunk ; c++ )
+        {
+            if ( !chunk_ok_vec[c] )
+            {
+                mesh = IndexedMeshData();
+                return false;
+            }
+        }
+
+        for ( int c = 0 ; c < nchunk ; c++ )
+        {
+            corner_vec.insert( corner_vec.end(), chunk_corner_vec[c].begin(), chunk_corner_vec[c].end() );
+            mesh.m_NormVec.insert( mesh.m_NormVec.end(), chunk_norm_vec[c].begin(), chunk_norm_vec[c].end() );
+            vector< vec3d >().swap( chunk_corner_vec[c] );
+            vector< vec3d >().swap( chunk_norm_vec[c] );
+        }
+    }
+
+    MergeIdenticalPnts( corner_vec, mesh.m_PntVec, mesh.m_TriVec );
+
+    return mesh.GetNumTris() > 0;
+}
+
+//==============================================================================//
+//============================= Indexed Tri Files ==============================//
+//==============================================================================//
+
+bool MeshFileUtil::ReadIndexedTriFile( const char* file_name, int vals_per_tri, IndexedMeshData & mesh )
+{
+    mesh = IndexedMeshData();
+
+    MappedFile file;
+    if ( !file.Open( file_name ) )
+    {
+        return false;
+    }
+
+    const char* ptr = file.GetData();
+    const char* end = ptr + file.GetSize();
+
+    int num_nodes = 0;
+    int num_tris = 0;
+    if ( !ParseInt( ptr, end, num_nodes ) || !ParseInt( ptr, end, num_tris ) || num_nodes < 0 || num_tris < 0 )
+    {
+        return false;
+    }
+
+    //==== Each Node Or Tri Takes At Least Three Numbers And Separators - Do Not Trust Larger Counts ====//
+    if ( 6 * ( uint64_t ) num_nodes > ( uint64_t )( end - ptr ) + 1 )
+    {
+        return false;
+    }
+
+    mesh.m_PntVec.resize( num_nodes );
+    for ( int i = 0 ; i < num_nodes ; i++ )
+    {
+        float x, y, z;
+        if ( !ParseFloat( ptr, end, x ) || !ParseFloat( ptr, end, y ) || !ParseFloat( ptr, end, z ) )
+        {
+            mesh = IndexedMeshData();
+            return false;
+        }
+        mesh.m_PntVec[i].set_xyz( x, y, z );
+    }
+
+    mesh.m_TriVec.reserve( 3 * ( size_t ) std::min( ( uint64_t ) num_tris, ( uint64_t )( end - ptr ) / 6 + 1 ) );
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        int n[3];
+        if ( !ParseInt( ptr, end, n[0] ) || !ParseInt( ptr, end, n[1] ) || !ParseInt( ptr, end, n[2] ) )
+        {
+            break;
+        }
+
+        for ( int k = 0 ; k < vals_per_tri ; k++ )
+        {
+            double val;
+            ParseDouble( ptr, end, val );
+        }
+
+        //==== Skip Tris That Reference Missing Nodes ====//
+        if ( n[0] < 1 || n[0] > num_nodes || n[1] < 1 || n[1] > num_nodes || n[2] < 1 || n[2] > num_nodes )
+        {
+            continue;
+        }
+
+        mesh.m_TriVec.push_back( n[0] - 1 );
+        mesh.m_TriVec.push_back( n[1] - 1 );
+        mesh.m_TriVec.push_back( n[2] - 1 );
+    }
+
+    return mesh.GetNumTris() > 0;
+}
@@ -0,0 +1,101 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//******************************************************************************
+//
+//   Mesh File Readers
+//
+//   Readers for STL, Cart3D TRI and Nascart files that memory map the file,
+//   parse numbers without going through the C stream functions and return
+//   indexed meshes with shared vertices.
+//
+//******************************************************************************
+
+#if !defined(MESH_FILE_UTIL__INCLUDED_)
+#define MESH_FILE_UTIL__INCLUDED_
+
+#include "Vec3d.h"
+
+#include <stddef.h>
+#include <vector>
+using std::vector;
+
+//==== Read Only View Of A Whole File, Memory Mapped When Possible ====//
+class MappedFile
+{
+public:
+
+    MappedFile();
+    ~MappedFile();
+
+    bool Open( const char* file_name );
+    void Close();
+
+    const char* GetData() const
+    {
+        return m_Data;
+    }
+    size_t GetSize() const
+    {
+        return m_Size;
+    }
+
+protected:
+
+    const char* m_Data;
+    size_t m_Size;
+
+    void* m_MapPtr;                 // Mapping, NULL if the file was read into m_Buffer
+    vector< char > m_Buffer;
+
+#ifdef WIN32
+    void* m_FileHandle;
+    void* m_MapHandle;
+#endif
+
+private:
+
+    MappedFile( const MappedFile & );
+    MappedFile & operator=( const MappedFile & );
+};
+
+//==== Indexed Triangle Mesh As Read From A File ====//
+class IndexedMeshData
+{
+public:
+
+    vector< vec3d > m_PntVec;
+    vector< int > m_TriVec;         // Three 0 based indices into m_PntVec per tri
+    vector< vec3d > m_NormVec;      // One per tri, only filled by ReadSTL
+
+    int GetNumTris() const
+    {
+        return ( int )m_TriVec.size() / 3;
+    }
+};
+
+namespace MeshFileUtil
+{
+
+//==== Skip White Space And Parse One Number, Returns False And Leaves ptr If None ====//
+bool ParseDouble( const char* & ptr, const char* end, double & val );
+// Rounded straight to float like fscanf %f, which the ASCII mesh formats were always read with.
+bool ParseFloat( const char* & ptr, const char* end, float & val );
+bool ParseInt( const char* & ptr, const char* end, int & val );
+
+//==== Replace Bit Identical Points With One Shared Point ====//
+void MergeIdenticalPnts( const vector< vec3d > & pnt_vec, vector< vec3d > & unique_vec, vector< int > & index_vec );
+
+//==== Binary Or ASCII STL, Vertices Are Merged When Bit Identical - Coordinates Are float Precision ====//
+bool ReadSTL( const char* file_name, IndexedMeshData & mesh, bool parallel = true );
+
+//==== Node Count, Tri Count, Nodes, Then One Line Of 1 Based Indices Per Tri ====//
+// vals_per_tri counts the extra values after the indices - 0 for Cart3D TRI, 1 for Nascart.
+// Node coordinates are read as float. Counts that the file is too short to hold fail the read.
+bool ReadIndexedTriFile( const char* file_name, int vals_per_tri, IndexedMeshData & mesh );
+
+}
+
+#endif
@@ -0,0 +1,73 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#include "ParallelUtil.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using std::vector;
+
+static std::atomic< int > g_NumParallelThreads( 0 );
+
+void SetNumParallelThreads( int num_threads )
+{
+    g_NumParallelThreads = std::max( num_threads, 0 );
+}
+
+int GetNumParallelThreads()
+{
+    int num_threads = g_NumParallelThreads;
+
+    if ( num_threads <= 0 )
+    {
+        num_threads = ( int )std::thread::hardware_concurrency();
+    }
+
+    return std::max( num_threads, 1 );
+}
+
+void ParallelFor( int num_tasks, const std::function< void( int ) > & func )
+{
+    int num_threads = std::min( GetNumParallelThreads(), num_tasks );
+
+    //==== Serial ====//
+    if ( num_threads <= 1 )
+    {
+        for ( int i = 0 ; i < num_tasks ; i++ )
+        {
+            func( i );
+        }
+        return;
+    }
+
+    //==== Each Worker Pulls The Next Task Until None Are Left ====//
+    std::atomic< int > next_task( 0 );
+
+    auto worker = [&]()
+    {
+        int i;
+        while ( ( i = next_task++ ) < num_tasks )
+        {
+            func( i );
+        }
+    };
+
+    vector< std::thread > threads;
+    threads.reserve( num_threads - 1 );
+    for ( int t = 1 ; t < num_threads ; t++ )
+    {
+        threads.push_back( std::thread( worker ) );
+    }
+
+    worker();
+
+    for ( int t = 0 ; t < ( int )threads.size() ; t++ )
+    {
+        threads[t].join();
+    }
+}
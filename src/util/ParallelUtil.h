@@ -0,0 +1,28 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//******************************************************************************
+//
+//   Parallel For Helpers
+//
+//   Run independent, indexed tasks on worker threads.  Tasks are handed out
+//   dynamically, so callers that need results identical to a serial loop must
+//   write each task's output to its own slot and merge the slots in index order.
+//
+//******************************************************************************
+
+#if !defined(PARALLEL_UTIL__INCLUDED_)
+#define PARALLEL_UTIL__INCLUDED_
+
+#include <functional>
+
+//==== Number of Worker Threads, 0 Uses All Hardware Threads, 1 Runs Serial ====//
+void SetNumParallelThreads( int num_threads );
+int GetNumParallelThreads();
+
+//==== Call func( i ) For 0 <= i < num_tasks, Returns When All Are Done ====//
+void ParallelFor( int num_tasks, const std::function< void( int ) > & func );
+
+#endif
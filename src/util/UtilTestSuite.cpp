@@ -10,6 +10,9 @@
 #include <float.h>
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "ParallelUtil.h"
+#include "BndBoxTree.h"
+#include "MeshFileUtil.h"
 
 
 //==== Test vec2d ====//
@@ -665,3 +668,187 @@ void UtilTestSuite::BilinearInterpTest()
     TEST_ASSERT_DELTA( interp_val, 9.8125, DBL_EPSILON );
 
 }
+
+void UtilTestSuite::ParallelForTest()
+{
+    //==== Every Task Runs Exactly Once, Serial And Threaded ====//
+    int nthread[3] = { 1, 4, 0 };
+    for ( int n = 0 ; n < 3 ; n++ )
+    {
+        SetNumParallelThreads( nthread[n] );
+
+        vector< int > count( 1000, 0 );
+        ParallelFor( ( int )count.size(), [&]( int i )
+        {
+            count[i]++;
+        } );
+
+        for ( int i = 0 ; i < ( int )count.size() ; i++ )
+        {
+            TEST_ASSERT( count[i] == 1 );
+        }
+    }
+
+    //==== No Tasks ====//
+    bool called = false;
+    ParallelFor( 0, [&]( int i )
+    {
+        called = true;
+    } );
+    TEST_ASSERT( !called );
+
+    SetNumParallelThreads( 0 );   // Back to default
+}
+
+void UtilTestSuite::BndBoxTreeTest()
+{
+    //==== Grid Of Overlapping Boxes ====//
+    vector< BndBox > box_vec;
+    for ( int i = 0 ; i < 10 ; i++ )
+        for ( int j = 0 ; j < 10 ; j++ )
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                vec3d p( i, j * 0.5, k * 2.0 );
+                box_vec.push_back( BndBox( p, p + vec3d( 1.5, 1.0, 0.5 ) ) );
+            }
+
+    BndBoxTree tree;
+    TEST_ASSERT( tree.IsEmpty() );
+    tree.Build( box_vec );
+    TEST_ASSERT( !tree.IsEmpty() );
+
+    //==== Tree Queries Match A Linear Scan ====//
+    vector< int > ind_vec;
+    for ( int q = 0 ; q < 50 ; q++ )
+    {
+        vec3d p( 0.23 * q, 0.17 * q, 0.11 * q );
+
+        vector< int > scan_vec;
+        for ( int b = 0 ; b < ( int )box_vec.size() ; b++ )
+        {
+            if ( box_vec[b].CheckPnt( p ) )
+            {
+                scan_vec.push_back( b );
+            }
+        }
+        tree.FindContaining( p, ind_vec );
+        TEST_ASSERT( ind_vec == scan_vec );
+
+        BndBox qbox( p, p + vec3d( 0.7, 0.3, 1.1 ) );
+        scan_vec.clear();
+        for ( int b = 0 ; b < ( int )box_vec.size() ; b++ )
+        {
+            if ( Compare( box_vec[b], qbox ) )
+            {
+                scan_vec.push_back( b );
+            }
+        }
+        tree.FindOverlaps( qbox, ind_vec );
+        TEST_ASSERT( ind_vec == scan_vec );
+    }
+
+    //==== Far Away Point ====//
+    tree.FindContaining( vec3d( 100, 100, 100 ), ind_vec );
+    TEST_ASSERT( ind_vec.empty() );
+
+    tree.Clear();
+    TEST_ASSERT( tree.IsEmpty() );
+}
+
+void UtilTestSuite::MeshFileUtilTest()
+{
+    //==== Numbers Match strtod ====//
+    const char* num_str[] = { "0", "-0.5", "+12", "1.2345678901e-05", "6.02214076E+23", ".25", "3.", "1e-320",
+                              "0.1000000000000000055511151231257827", "123456789012345678901234" };
+    for ( int i = 0 ; i < 10 ; i++ )
+    {
+        const char* ptr = num_str[i];
+        const char* end = ptr + strlen( ptr );
+        double val = 0.0;
+        TEST_ASSERT( MeshFileUtil::ParseDouble( ptr, end, val ) );
+        TEST_ASSERT( ptr == end );
+        TEST_ASSERT( val == strtod( num_str[i], NULL ) );
+    }
+
+    //==== Floats Match strtof, As The Readers Used fscanf %f ====//
+    const char* flt_str[] = { "0.1", "-1.5e-3", "16777217", "3.4028235e38", "1.17549435e-38", "0.30000001192092896", "7.038531e-26" };
+    for ( int i = 0 ; i < 7 ; i++ )
+    {
+        const char* ptr = flt_str[i];
+        float fval = 0.0f;
+        TEST_ASSERT( MeshFileUtil::ParseFloat( ptr, ptr + strlen( ptr ), fval ) );
+        TEST_ASSERT( fval == strtof( flt_str[i], NULL ) );
+    }
+
+    const char* bad_str = "  vertex";
+    const char* ptr = bad_str;
+    double val = 0.0;
+    TEST_ASSERT( !MeshFileUtil::ParseDouble( ptr, bad_str + strlen( bad_str ), val ) );
+    TEST_ASSERT( ptr == bad_str + 2 );
+
+    //==== Two Solids, Shared Corners Merged ====//
+    string file_name = "mesh_file_util_test.stl";
+    FILE* fp = fopen( file_name.c_str(), "w" );
+    TEST_ASSERT( fp != NULL );
+    if ( !fp )
+    {
+        return;
+    }
+    fprintf( fp, "solid a\n facet normal 0 0 1\n  outer loop\n   vertex 0 0 0\n   vertex 1 0 0\n   vertex 0 1 0\n" );
+    fprintf( fp, "  endloop\n endfacet\nendsolid a\nsolid b\n facet normal 0 0 1\n  outer loop\n" );
+    fprintf( fp, "   vertex 1 0 0\n   vertex 1 1 0\n   vertex 0 1 0\n  endloop\n endfacet\nendsolid b\n" );
+    fclose( fp );
+
+    IndexedMeshData mesh;
+    TEST_ASSERT( MeshFileUtil::ReadSTL( file_name.c_str(), mesh ) );
+    TEST_ASSERT( mesh.GetNumTris() == 2 );
+    TEST_ASSERT( mesh.m_PntVec.size() == 4 );
+    TEST_ASSERT( mesh.m_NormVec.size() == 2 );
+    TEST_ASSERT( mesh.m_TriVec[1] == mesh.m_TriVec[3] );
+    TEST_ASSERT( mesh.m_TriVec[2] == mesh.m_TriVec[5] );
+    TEST_ASSERT( dist( mesh.m_PntVec[ mesh.m_TriVec[4] ], vec3d( 1, 1, 0 ) ) < DBL_EPSILON );
+
+    //==== Malformed Number Fails The Read ====//
+    fp = fopen( file_name.c_str(), "w" );
+    TEST_ASSERT( fp != NULL );
+    if ( !fp )
+    {
+        return;
+    }
+    fprintf( fp, "solid a\n facet normal 0 0 1\n  outer loop\n   vertex 0 0 0\n   vertex 1 x 0\n   vertex 0 1 0\n" );
+    fprintf( fp, "  endloop\n endfacet\nendsolid a\n" );
+    fclose( fp );
+
+    TEST_ASSERT( !MeshFileUtil::ReadSTL( file_name.c_str(), mesh ) );
+    TEST_ASSERT( mesh.GetNumTris() == 0 );
+
+    remove( file_name.c_str() );
+
+    //==== Counts The File Can Not Hold Fail Before Allocating ====//
+    file_name = "mesh_file_util_test.tri";
+    fp = fopen( file_name.c_str(), "w" );
+    TEST_ASSERT( fp != NULL );
+    if ( !fp )
+    {
+        return;
+    }
+    fprintf( fp, "2000000000 2000000000\n0 0 0\n" );
+    fclose( fp );
+
+    TEST_ASSERT( !MeshFileUtil::ReadIndexedTriFile( file_name.c_str(), 0, mesh ) );
+
+    fp = fopen( file_name.c_str(), "w" );
+    TEST_ASSERT( fp != NULL );
+    if ( !fp )
+    {
+        return;
+    }
+    fprintf( fp, "3 1\n0 0 0 1 0.1 0 0 1 0 1 2 3" );
+    fclose( fp );
+
+    TEST_ASSERT( MeshFileUtil::ReadIndexedTriFile( file_name.c_str(), 0, mesh ) );
+    TEST_ASSERT( mesh.GetNumTris() == 1 );
+    TEST_ASSERT( mesh.m_PntVec[1].y() == ( double ) 0.1f );
+
+    remove( file_name.c_str() );
+}
@@ -36,6 +36,9 @@ public:
         TEST_ADD( UtilTestSuite::SharedPtrTest )
         TEST_ADD( UtilTestSuite::PointInPolyTest )
         TEST_ADD( UtilTestSuite::BilinearInterpTest )
+        TEST_ADD( UtilTestSuite::ParallelForTest )
+        TEST_ADD( UtilTestSuite::BndBoxTreeTest )
+        TEST_ADD( UtilTestSuite::MeshFileUtilTest )
     }
 
 private:
@@ -48,6 +51,9 @@ private:
     void SharedPtrTest();
     void PointInPolyTest();
     void BilinearInterpTest();
+    void ParallelForTest();
+    void BndBoxTreeTest();
+    void MeshFileUtilTest();
 
     void WritePntVecs( vector< vector< vec3d > > & pnt_vecs,  string file_name );
     void WriteCurve( VspCurve& crv, string file_name );
@@ -0,0 +1,241 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// benchmark_main.cpp: Timing of geometry analyses on a representative
+// aircraft, old algorithms against new ones.  Not a test, it only prints.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+#include "VSP_Geom_API.h"
+#include "TMesh.h"
+#include "Mesh.h"
+#include "LinkMgr.h"
+
+using std::string;
+using std::vector;
+
+static double ElapsedSec( std::chrono::steady_clock::time_point start )
+{
+    return std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+}
+
+//==== Fuselage, Long Thin Wing, Tails And Pods - Tess Scaled By tess_scale ====//
+static void BuildAircraft( int tess_scale )
+{
+    vsp::VSPRenew();
+
+    string fus_id = vsp::AddGeom( "FUSELAGE" );
+    vsp::SetParmVal( fus_id, "Length", "Design", 40.0 );
+    vsp::SetParmVal( fus_id, "Tess_U", "Shape", 8 * tess_scale );
+    vsp::SetParmVal( fus_id, "Tess_W", "Shape", 17 * tess_scale );
+
+    string wing_id = vsp::AddGeom( "WING" );
+    vsp::SetParmVal( wing_id, "X_Rel_Location", "XForm", 15.0 );
+    vsp::SetParmVal( wing_id, "TotalSpan", "WingGeom", 60.0 );
+    vsp::SetParmVal( wing_id, "Tess_W", "Shape", 17 * tess_scale );
+    vsp::SetParmVal( wing_id, "SectTess_U", "XSec_1", 20 * tess_scale );
+
+    string htail_id = vsp::AddGeom( "WING" );
+    vsp::SetParmVal( htail_id, "X_Rel_Location", "XForm", 36.0 );
+    vsp::SetParmVal( htail_id, "TotalSpan", "WingGeom", 14.0 );
+    vsp::SetParmVal( htail_id, "Tess_W", "Shape", 17 * tess_scale );
+    vsp::SetParmVal( htail_id, "SectTess_U", "XSec_1", 8 * tess_scale );
+
+    string vtail_id = vsp::AddGeom( "WING" );
+    vsp::SetParmVal( vtail_id, "X_Rel_Location", "XForm", 35.0 );
+    vsp::SetParmVal( vtail_id, "X_Rel_Rotation", "XForm", 90.0 );
+    vsp::SetParmVal( vtail_id, "Sym_Planar_Flag", "Sym", 0 );
+    vsp::SetParmVal( vtail_id, "TotalSpan", "WingGeom", 7.0 );
+    vsp::SetParmVal( vtail_id, "Tess_W", "Shape", 17 * tess_scale );
+    vsp::SetParmVal( vtail_id, "SectTess_U", "XSec_1", 8 * tess_scale );
+
+    for ( int i = 0 ; i < 2 ; i++ )
+    {
+        string pod_id = vsp::AddGeom( "POD", wing_id );
+        vsp::SetParmVal( pod_id, "X_Rel_Location", "XForm", 12.0 );
+        vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", 8.0 + 8.0 * i );
+        vsp::SetParmVal( pod_id, "Z_Rel_Location", "XForm", -0.8 );
+        vsp::SetParmVal( pod_id, "Length", "Design", 6.0 );
+        vsp::SetParmVal( pod_id, "Tess_U", "Shape", 8 * tess_scale );
+        vsp::SetParmVal( pod_id, "Tess_W", "Shape", 9 * tess_scale );
+    }
+
+    vsp::Update();
+}
+
+//==== Run CompGeom, MassProp, WaveDrag And Clearance, Print Times And Results ====//
+static void RunMeshAnalyses( const char* label )
+{
+    std::chrono::steady_clock::time_point start;
+
+    start = std::chrono::steady_clock::now();
+    string mesh_id = vsp::ComputeCompGeom( vsp::SET_ALL, false, 0 );
+    double t_comp = ElapsedSec( start );
+    string comp_res = vsp::FindLatestResultsID( "Comp_Geom" );
+    double wet_area = vsp::GetDoubleResults( comp_res, "Total_Wet_Area" )[0];
+    vsp::DeleteGeom( mesh_id );
+
+    start = std::chrono::steady_clock::now();
+    mesh_id = vsp::ComputeMassProps( vsp::SET_ALL, 50 );
+    double t_mass = ElapsedSec( start );
+    string mass_res = vsp::FindLatestResultsID( "Mass_Properties" );
+    double mass = vsp::GetDoubleResults( mass_res, "Total_Mass" )[0];
+    vsp::DeleteGeom( mesh_id );
+
+    start = std::chrono::steady_clock::now();
+    vsp::SetAnalysisInputDefaults( "WaveDrag" );
+    string wave_res = vsp::ExecAnalysis( "WaveDrag" );
+    double t_wave = ElapsedSec( start );
+    double cd_wave = vsp::GetDoubleResults( wave_res, "CDWave" )[0];
+
+    vector< string > geom_vec = vsp::FindGeoms();
+    start = std::chrono::steady_clock::now();
+    double clearance = vsp::ComputeMinClearanceDistance( geom_vec.back(), vsp::SET_ALL );
+    double t_clear = ElapsedSec( start );
+
+    printf( "%-8s CompGeom %8.3f s  MassProp %8.3f s  WaveDrag %8.3f s  Clearance %8.3f s\n",
+            label, t_comp, t_mass, t_wave, t_clear );
+    printf( "%-8s Wet_Area %.6g  Total_Mass %.6g  CDWave %.6g  Clearance %.6g\n",
+            "", wet_area, mass, cd_wave, clearance );
+}
+
+//==== TMesh Spatial Search - Octree Against SAH BVH ====//
+static void BenchmarkTMeshSearch( int tess_scale )
+{
+    printf( "\nTMesh spatial search, tess scale %d\n", tess_scale );
+
+    BuildAircraft( tess_scale );
+
+    TBndBox::SetOctreeFlag( true );
+    RunMeshAnalyses( "Octree" );
+
+    TBndBox::SetOctreeFlag( false );
+    RunMeshAnalyses( "BVH" );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+}
+
+//==== CFD Mesh - Pooled Node/Edge/Tri Storage Against Plain new/delete ====//
+static void RunCfdMesh( const char* label )
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    vsp::ComputeCFDMesh( vsp::SET_ALL, 0 );
+    double t_mesh = ElapsedSec( start );
+
+    printf( "%-8s CFDMesh %8.3f s\n", label, t_mesh );
+}
+
+static void BenchmarkCfdMesh( int tess_scale )
+{
+    printf( "\nCFD mesh storage, tess scale %d\n", tess_scale );
+
+    BuildAircraft( tess_scale );
+    vsp::SetCFDMeshVal( vsp::CFD_MAX_EDGE_LEN, 1.0 );
+    vsp::SetCFDMeshVal( vsp::CFD_MIN_EDGE_LEN, 0.05 );
+
+    Mesh::SetPoolFlag( false );
+    RunCfdMesh( "new" );
+
+    Mesh::SetPoolFlag( true );
+    RunCfdMesh( "Pooled" );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+}
+
+//==== SetParmVal And FindGeom Throughput On A Large, Heavily Linked Model ====//
+static void BenchmarkParmLinks( int num_geom, int num_link )
+{
+    printf( "\nSetParmVal with %d geoms and %d links\n", num_geom, num_link );
+
+    vsp::VSPRenew();
+
+    vector< string > geom_vec( num_geom );
+    for ( int i = 0 ; i < num_geom ; i++ )
+    {
+        geom_vec[i] = vsp::AddGeom( "POD" );
+    }
+
+    const int num_parm = 8;
+    const char* parm_names[num_parm] = { "X_Rel_Location", "Y_Rel_Location", "Z_Rel_Location",
+                                         "X_Rel_Rotation", "Y_Rel_Rotation", "Z_Rel_Rotation",
+                                         "Length", "FineRatio" };
+    const char* parm_groups[num_parm] = { "XForm", "XForm", "XForm", "XForm", "XForm", "XForm",
+                                          "Design", "Design" };
+
+    //==== Sources In The First Half, Targets In The Second, So Links Never Chain ====//
+    int nhalf = num_geom / 2;
+    for ( int k = 0 ; k < num_link ; k++ )
+    {
+        int ia = k % nhalf;
+        int ib = nhalf + ( k * 7 ) % ( num_geom - nhalf );
+        int ip = ( k / nhalf ) % num_parm;
+
+        string pa = vsp::FindParm( geom_vec[ia], parm_names[ip], parm_groups[ip] );
+        string pb = vsp::FindParm( geom_vec[ib], parm_names[ip], parm_groups[ip] );
+        LinkMgr.AddLink( pa, pb );
+    }
+
+    //==== Parms That Are Not Link Sources - Every Set Still Looks For Links ====//
+    vector< string > set_vec;
+    for ( int i = nhalf ; i < num_geom ; i++ )
+    {
+        set_vec.push_back( vsp::FindParm( geom_vec[i], "Tess_W", "Shape" ) );
+    }
+
+    int num_set = 20000;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for ( int i = 0 ; i < num_set ; i++ )
+    {
+        vsp::SetParmVal( set_vec[ i % set_vec.size() ], 9 + ( i / set_vec.size() ) % 2 );
+    }
+    double t_set = ElapsedSec( start );
+
+    int num_find = 200000;
+    size_t name_len = 0;
+    start = std::chrono::steady_clock::now();
+    for ( int i = 0 ; i < num_find ; i++ )
+    {
+        name_len += vsp::GetGeomName( geom_vec[ ( i * 13 ) % num_geom ] ).size();
+    }
+    double t_find = ElapsedSec( start );
+
+    printf( "SetParmVal %10.0f /s  FindGeom %10.0f /s  (links %d, names %d)\n",
+            num_set / t_set, num_find / t_find, LinkMgr.GetNumLinks(), ( int )name_len );
+
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+}
+
+//========================================================//
+//========================= Main =========================//
+int main( int argc, char** argv )
+{
+    int tess_scale = 2;
+
+    for ( int i = 1 ; i < argc ; i++ )
+    {
+        if ( strcmp( argv[i], "-tess" ) == 0 && i + 1 < argc )
+        {
+            tess_scale = atoi( argv[++i] );
+        }
+        else
+        {
+            printf( "Usage: vspbench [-tess <scale>]\n" );
+            return 1;
+        }
+    }
+
+    vsp::VSPCheckSetup();
+
+    BenchmarkTMeshSearch( tess_scale );
+    BenchmarkCfdMesh( tess_scale );
+    BenchmarkParmLinks( 500, 2000 );
+
+    return 0;
+}
@@ -7,6 +7,7 @@
 #include "main.h"
 #include "VSP_Geom_API.h"
 #include "DesignVarMgr.h"
+#include "ScriptMgr.h"
 
 // Bitwise adds ecode to the current exit status code and returns to current exit status code
 int vsp_add_and_get_estatus( int ecode )
@@ -60,6 +61,13 @@ int batchMode( int argc, char *argv[], Vehicle* vPtr )
                 desModeFlag = 1;
             }
         }
+        else if ( strcmp( argv[i], "-scriptcache" ) == 0 )
+        {
+            if ( i + 1 < argc )
+            {
+                ScriptMgr.SetByteCodeCacheDir( string( argv[++i] ) );
+            }
+        }
         else if ( strcmp( argv[i], "-xddm" ) == 0 )
         {
             if ( i + 1 < argc )
@@ -87,6 +95,7 @@ int batchMode( int argc, char *argv[], Vehicle* vPtr )
             printf( "  -help              This message\n" );
             printf( "  -des <desfile>     Set variables according to *.des file\n" );
             printf( "  -xddm <xddmfile>   Set variables according to *.xddm file\n" );
+            printf( "  -scriptcache <dir> Cache compiled scripts in <dir>, delete it to clear\n" );
             printf( "\n" );
             printf( "-----------------------------------------------------------\n" );
             return 1;
@@ -7,6 +7,144 @@
 #include "XmlUtil.h"
 #include "StringUtil.h"
 #include <cfloat>
+#include <cctype>
+#include <stdint.h>
+
+// libxml2 refuses text nodes over 10MB unless parsing with XML_PARSE_HUGE,
+// so binary payloads are split into Data children of at most this many bytes.
+static const size_t BINARY_CHUNK_BYTES = 3 * 1024 * 1024;
+
+static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+//==== Encode Bytes As Base64 Text ====//
+static void EncodeBase64( const unsigned char* data, size_t num_bytes, string & str )
+{
+    str.clear();
+    str.reserve( 4 * ( ( num_bytes + 2 ) / 3 ) );
+
+    size_t i = 0;
+    for ( ; i + 2 < num_bytes ; i += 3 )
+    {
+        uint32_t v = ( data[i] << 16 ) | ( data[i + 1] << 8 ) | data[i + 2];
+        str.push_back( BASE64_CHARS[ ( v >> 18 ) & 63 ] );
+        str.push_back( BASE64_CHARS[ ( v >> 12 ) & 63 ] );
+        str.push_back( BASE64_CHARS[ ( v >> 6 ) & 63 ] );
+        str.push_back( BASE64_CHARS[ v & 63 ] );
+    }
+
+    if ( i < num_bytes )
+    {
+        uint32_t v = data[i] << 16;
+        if ( i + 1 < num_bytes )
+        {
+            v |= data[i + 1] << 8;
+        }
+        str.push_back( BASE64_CHARS[ ( v >> 18 ) & 63 ] );
+        str.push_back( BASE64_CHARS[ ( v >> 12 ) & 63 ] );
+        str.push_back( i + 1 < num_bytes ? BASE64_CHARS[ ( v >> 6 ) & 63 ] : '=' );
+        str.push_back( '=' );
+    }
+}
+
+//==== Decode Base64 Text And Append The Bytes, Whitespace Is Skipped ====//
+static bool DecodeBase64( const char* str, vector< unsigned char > & bytes )
+{
+    static signed char lookup[256];
+    static bool init = false;
+    if ( !init )
+    {
+        memset( lookup, -1, sizeof( lookup ) );
+        for ( int i = 0 ; i < 64 ; i++ )
+        {
+            lookup[ ( unsigned char ) BASE64_CHARS[i] ] = i;
+        }
+        init = true;
+    }
+
+    uint32_t v = 0;
+    int nbits = 0;
+    for ( const char* c = str ; *c ; c++ )
+    {
+        if ( *c == '=' )
+        {
+            break;
+        }
+        signed char d = lookup[ ( unsigned char ) *c ];
+        if ( d < 0 )
+        {
+            if ( isspace( ( unsigned char ) *c ) )
+            {
+                continue;
+            }
+            return false;
+        }
+        v = ( v << 6 ) | d;
+        nbits += 6;
+        if ( nbits >= 8 )
+        {
+            nbits -= 8;
+            bytes.push_back( ( unsigned char )( ( v >> nbits ) & 0xFF ) );
+        }
+    }
+    return true;
+}
+
+//==== Write Bytes As Base64 Data Chunks ====//
+static xmlNodePtr AddBinaryNode( xmlNodePtr root, const char * name, const vector< unsigned char > & bytes )
+{
+    xmlNodePtr node = xmlNewChild( root, NULL, ( const xmlChar * )name, NULL );
+    XmlUtil::SetIntProp( node, "Bytes", ( int )bytes.size() );
+
+    string str;
+    for ( size_t start = 0 ; start < bytes.size() ; start += BINARY_CHUNK_BYTES )
+    {
+        size_t num = std::min( BINARY_CHUNK_BYTES, bytes.size() - start );
+        EncodeBase64( &bytes[start], num, str );
+        XmlUtil::AddStringNode( node, "Data", str );
+    }
+    return node;
+}
+
+//==== Read Bytes From Base64 Data Chunks ====//
+static bool ExtractBinaryNode( xmlNodePtr root, const char * name, vector< unsigned char > & bytes )
+{
+    bytes.clear();
+
+    xmlNodePtr node = XmlUtil::GetNode( root, name, 0 );
+    if ( !node )
+    {
+        return false;
+    }
+
+    int num_bytes = XmlUtil::FindIntProp( node, "Bytes", -1 );
+    if ( num_bytes < 0 )
+    {
+        return false;
+    }
+    bytes.reserve( num_bytes );
+
+    for ( xmlNodePtr iter_node = node->xmlChildrenNode ; iter_node != NULL ; iter_node = iter_node->next )
+    {
+        if ( !xmlStrcmp( iter_node->name, ( const xmlChar * )"Data" ) )
+        {
+            char* str = ( char* )xmlNodeListGetString( iter_node->doc, iter_node->xmlChildrenNode, 1 );
+            bool ok = !str || DecodeBase64( str, bytes );
+            xmlFree( str );
+            if ( !ok )
+            {
+                bytes.clear();
+                return false;
+            }
+        }
+    }
+
+    if ( ( int )bytes.size() != num_bytes )
+    {
+        bytes.clear();
+        return false;
+    }
+    return true;
+}
 
 //==== Get Number of Same Names ====//
 int XmlUtil::GetNumNames( xmlNodePtr node, const char * name )
@@ -658,6 +796,85 @@ vector< vec3d > XmlUtil::GetVectorVec3dNode( xmlNodePtr node )
     return ret_vec;
 }
 
+//==== Create Node and Add Vector Of Ints As 32 Bit Little Endian Base64 ====//
+xmlNodePtr XmlUtil::AddBinaryIntNode( xmlNodePtr root, const char * name, const vector< int > & vec )
+{
+    vector< unsigned char > bytes( 4 * vec.size() );
+    for ( size_t i = 0 ; i < vec.size() ; i++ )
+    {
+        uint32_t v = ( uint32_t ) vec[i];
+        for ( int b = 0 ; b < 4 ; b++ )
+        {
+            bytes[ 4 * i + b ] = ( unsigned char )( ( v >> ( 8 * b ) ) & 0xFF );
+        }
+    }
+    return AddBinaryNode( root, name, bytes );
+}
+
+//==== Create Node and Add Vector Of Doubles As 64 Bit Little Endian Base64 ====//
+xmlNodePtr XmlUtil::AddBinaryDoubleNode( xmlNodePtr root, const char * name, const vector< double > & vec )
+{
+    vector< unsigned char > bytes( 8 * vec.size() );
+    for ( size_t i = 0 ; i < vec.size() ; i++ )
+    {
+        uint64_t v;
+        memcpy( &v, &vec[i], sizeof( v ) );
+        for ( int b = 0 ; b < 8 ; b++ )
+        {
+            bytes[ 8 * i + b ] = ( unsigned char )( ( v >> ( 8 * b ) ) & 0xFF );
+        }
+    }
+    return AddBinaryNode( root, name, bytes );
+}
+
+//==== Extract Vector Of Ints Written By AddBinaryIntNode ====//
+bool XmlUtil::ExtractBinaryIntNode( xmlNodePtr root, const char * name, vector< int > & vec )
+{
+    vec.clear();
+
+    vector< unsigned char > bytes;
+    if ( !ExtractBinaryNode( root, name, bytes ) || bytes.size() % 4 )
+    {
+        return false;
+    }
+
+    vec.resize( bytes.size() / 4 );
+    for ( size_t i = 0 ; i < vec.size() ; i++ )
+    {
+        uint32_t v = 0;
+        for ( int b = 0 ; b < 4 ; b++ )
+        {
+            v |= ( uint32_t ) bytes[ 4 * i + b ] << ( 8 * b );
+        }
+        vec[i] = ( int ) v;
+    }
+    return true;
+}
+
+//==== Extract Vector Of Doubles Written By AddBinaryDoubleNode ====//
+bool XmlUtil::ExtractBinaryDoubleNode( xmlNodePtr root, const char * name, vector< double > & vec )
+{
+    vec.clear();
+
+    vector< unsigned char > bytes;
+    if ( !ExtractBinaryNode( root, name, bytes ) || bytes.size() % 8 )
+    {
+        return false;
+    }
+
+    vec.resize( bytes.size() / 8 );
+    for ( size_t i = 0 ; i < vec.size() ; i++ )
+    {
+        uint64_t v = 0;
+        for ( int b = 0 ; b < 8 ; b++ )
+        {
+            v |= ( uint64_t ) bytes[ 8 * i + b ] << ( 8 * b );
+        }
+        memcpy( &vec[i], &v, sizeof( v ) );
+    }
+    return true;
+}
+
 //==== Encode File Contents ====//
 xmlNodePtr XmlUtil::EncodeFileContents( xmlNodePtr root, const char* file_name )
 {
@@ -68,6 +68,12 @@ vec2d GetVec2dNode( xmlNodePtr node );
 vec3d GetVec3dNode( xmlNodePtr node );
 vector< vec3d > GetVectorVec3dNode( xmlNodePtr node );
 
+//==== Base64 Little Endian Arrays - Exact And Much Faster To Parse Than Text Lists ====//
+xmlNodePtr AddBinaryIntNode( xmlNodePtr root, const char * name, const vector< int > & vec );
+xmlNodePtr AddBinaryDoubleNode( xmlNodePtr root, const char * name, const vector< double > & vec );
+bool ExtractBinaryIntNode( xmlNodePtr root, const char * name, vector< int > & vec );
+bool ExtractBinaryDoubleNode( xmlNodePtr root, const char * name, vector< double > & vec );
+
 xmlNodePtr EncodeFileContents( xmlNodePtr root, const char* file_name );
 xmlNodePtr DecodeFileContents( xmlNodePtr root, const char* file_name );
 